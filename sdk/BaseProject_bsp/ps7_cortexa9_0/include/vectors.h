@@ -38,6 +38,7 @@
 * ----- ---- -------- ---------------------------------------------------
 * 1.00a ecm  10/20/10 Initial version, moved over from bsp area
 * 6.0   mus  07/27/16 Consolidated vectors for a9,a53 and r5 processors
+* 7.0   bk   10/17/26 Added FIQFastInterrupt for the fast FIQ vector
 * </pre>
 *
 * @note
@@ -66,6 +67,9 @@ extern "C" {
 /************************** Function Prototypes ******************************/
 
 void FIQInterrupt(void);
+/* called directly by the fast FIQ vector (XIL_FIQ_FAST_VECTOR=1), defined
+ * by the application. It must not use floating point or NEON registers. */
+void FIQFastInterrupt(void);
 void IRQInterrupt(void);
 #if !defined (__aarch64__)
 void SWInterrupt(void);
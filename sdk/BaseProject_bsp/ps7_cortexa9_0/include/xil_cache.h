@@ -48,6 +48,11 @@
 * 3.04a sdm  01/02/12 Remove redundant dsb/dmb instructions in cache maintenance
 *		      APIs.
 * 6.8   aru  09/06/18 Removed compilation warnings for ARMCC toolchain.
+* 7.0   bk   10/17/26 Added flush threshold and flush counter APIs.
+* 7.0   bk   10/17/26 Added vectored range APIs Xil_DCacheFlushRangeV and
+*                     Xil_DCacheInvalidateRangeV.
+* 7.0   bk   10/17/26 XIL_CACHE_RANGE_CHUNK_SIZE moved here from xil_cache.c so
+*                     applications can bound the IRQ-off time of range APIs.
 * </pre>
 *
 ******************************************************************************/
@@ -96,12 +101,43 @@ extern "C" {
 
 #endif
 
+/*
+ * Range maintenance keeps IRQ/FIQ masked for at most this many bytes of
+ * cache lines, interrupts are taken between chunks. Multiple of 32. An
+ * override has to be given to the BSP and the application alike.
+ */
+#ifndef XIL_CACHE_RANGE_CHUNK_SIZE
+#define XIL_CACHE_RANGE_CHUNK_SIZE	4096U
+#endif
+
+/**
+ * Counters of Xil_DCacheFlushRange calls
+ */
+typedef struct {
+	u32 RangeFlushCount;	/**< Ranges flushed line by line */
+	u32 FullFlushCount;	/**< Ranges handled by Xil_DCacheFlush */
+} Xil_DCacheFlushStats;
+
+/**
+ * One address range of Xil_DCacheFlushRangeV / Xil_DCacheInvalidateRangeV
+ */
+typedef struct {
+	INTPTR Addr;	/**< Start address */
+	u32 Len;	/**< Length in bytes */
+} Xil_DCacheRange;
+
 void Xil_DCacheEnable(void);
 void Xil_DCacheDisable(void);
 void Xil_DCacheInvalidate(void);
 void Xil_DCacheInvalidateRange(INTPTR adr, u32 len);
 void Xil_DCacheFlush(void);
 void Xil_DCacheFlushRange(INTPTR adr, u32 len);
+void Xil_DCacheSetFlushThreshold(u32 Threshold);
+u32 Xil_DCacheGetFlushThreshold(void);
+u32 Xil_DCacheCalibrateFlushThreshold(INTPTR adr, u32 maxlen);
+void Xil_DCacheGetFlushStats(Xil_DCacheFlushStats *Stats);
+void Xil_DCacheFlushRangeV(const Xil_DCacheRange *Ranges, u32 Count);
+void Xil_DCacheInvalidateRangeV(const Xil_DCacheRange *Ranges, u32 Count);
 
 void Xil_ICacheEnable(void);
 void Xil_ICacheDisable(void);
@@ -178,6 +178,10 @@
 * 3.10  aru  08/23/18 Resolved MISRA-C:2012 compliance mandatory violations
 * 4.0   mus  11/22/18 Fixed bugs in software interrupt generation through 
 *                      XScuGic_SoftwareIntr API
+* 4.0   bk   10/17/26 Added mask based XScuGic_EnableMask, XScuGic_DisableMask
+*                     and XScuGic_SetPriorityTriggerTypeMask APIs.
+* 4.0   bk   10/17/26 Added XScuGic_InterruptHandlerChained, SpuriousInterrupts
+*                     and DispatchCount instance members.
 *
 * </pre>
 *
@@ -209,6 +213,12 @@ extern "C" {
 
 #define XSCUGIC500_DCTLR_ARE_NS_ENABLE  0x20
 #define XSCUGIC500_DCTLR_ARE_S_ENABLE  0x10
+
+/*
+ * Number of 32 bit words in an interrupt source bitmap passed to the
+ * XScuGic_*Mask APIs, bit n of word w selects Int_Id (w * 32) + n.
+ */
+#define XSCUGIC_INTR_MASK_WORDS	((XSCUGIC_MAX_NUM_INTR_INPUTS + 31U) / 32U)
 /**************************** Type Definitions *******************************/
 
 /* The following data type defines each entry in an interrupt vector table.
@@ -243,6 +253,10 @@ typedef struct
 	XScuGic_Config *Config;  /**< Configuration table entry */
 	u32 IsReady;		 /**< Device is initialized and ready */
 	u32 UnhandledInterrupts; /**< Intc Statistics */
+	u32 SpuriousInterrupts;	 /**< Chained handler entries that found no
+				 pending interrupt */
+	u32 DispatchCount[XSCUGIC_MAX_NUM_INTR_INPUTS]; /**< Handler calls per
+				 Int_Id made by XScuGic_InterruptHandlerChained */
 } XScuGic;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -557,6 +571,8 @@ void XScuGic_Disconnect(XScuGic *InstancePtr, u32 Int_Id);
 
 void XScuGic_Enable(XScuGic *InstancePtr, u32 Int_Id);
 void XScuGic_Disable(XScuGic *InstancePtr, u32 Int_Id);
+void XScuGic_EnableMask(XScuGic *InstancePtr, const u32 *MaskPtr);
+void XScuGic_DisableMask(XScuGic *InstancePtr, const u32 *MaskPtr);
 
 s32  XScuGic_CfgInitialize(XScuGic *InstancePtr, XScuGic_Config *ConfigPtr,
 							u32 EffectiveAddr);
@@ -567,6 +583,8 @@ void XScuGic_GetPriorityTriggerType(XScuGic *InstancePtr, u32 Int_Id,
 					u8 *Priority, u8 *Trigger);
 void XScuGic_SetPriorityTriggerType(XScuGic *InstancePtr, u32 Int_Id,
 					u8 Priority, u8 Trigger);
+void XScuGic_SetPriorityTriggerTypeMask(XScuGic *InstancePtr,
+				const u32 *MaskPtr, u8 Priority, u8 Trigger);
 void XScuGic_InterruptMaptoCpu(XScuGic *InstancePtr, u8 Cpu_Id, u32 Int_Id);
 void XScuGic_InterruptUnmapFromCpu(XScuGic *InstancePtr, u8 Cpu_Id, u32 Int_Id);
 void XScuGic_UnmapAllInterruptsFromCpu(XScuGic *InstancePtr, u8 Cpu_Id);
@@ -582,6 +600,9 @@ XScuGic_Config *XScuGic_LookupConfig(u16 DeviceId);
  * Interrupt functions in xscugic_intr.c
  */
 void XScuGic_InterruptHandler(XScuGic *InstancePtr);
+void XScuGic_InterruptHandlerChained(XScuGic *InstancePtr);
+u32 XScuGic_GetDispatchCount(XScuGic *InstancePtr, u32 Int_Id);
+void XScuGic_ClearDispatchCounts(XScuGic *InstancePtr);
 
 /*
  * Self-test functions in xscugic_selftest.c
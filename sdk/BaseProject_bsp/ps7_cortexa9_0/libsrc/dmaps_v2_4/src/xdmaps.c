@@ -66,6 +66,9 @@
 * 2.2  mus    12/08/16   Remove definition of INLINE macro to avoid re-definition,
 *                         since it is being defined in xil_io.h
 * 2.3 kpc     14/10/16   Fixed the compiler error when optimization O0 is used.
+* 2.4 bk      10/17/26   The generated DMA program is flushed together with the
+*                        source buffer in XDmaPs_Start using one
+*                        Xil_DCacheFlushRangeV call.
 * </pre>
 *
 *****************************************************************************/
@@ -1305,7 +1308,7 @@ static int XDmaPs_BuildDmaProg(unsigned Channel, XDmaPs_Cmd *Cmd,
 
 	DmaProgBytes = DmaProgBuf - DmaProgStart;
 
-	Xil_DCacheFlushRange((u32)DmaProgStart, DmaProgBytes);
+	/* The program is flushed by XDmaPs_Start together with the source */
 
 	return DmaProgBytes;
 
@@ -1460,6 +1463,8 @@ int XDmaPs_Start(XDmaPs *InstPtr, unsigned int Channel,
 	int Status;
 	u32 DmaProg = 0;
 	u32 Inten;
+	Xil_DCacheRange Ranges[2];
+	u32 NumRanges = 0;
 
 	Xil_AssertNonvoid(InstPtr != NULL);
 	Xil_AssertNonvoid(Cmd != NULL);
@@ -1496,8 +1501,18 @@ int XDmaPs_Start(XDmaPs *InstPtr, unsigned int Channel,
 
 		InstPtr->Chans[Channel].DmaCmdToHw = Cmd;
 
+		if (DmaProg == (u32)Cmd->GeneratedDmaProg) {
+			Ranges[NumRanges].Addr = (INTPTR)Cmd->GeneratedDmaProg;
+			Ranges[NumRanges].Len = Cmd->GeneratedDmaProgLength;
+			NumRanges++;
+		}
 		if (Cmd->ChanCtrl.SrcInc) {
-			Xil_DCacheFlushRange(Cmd->BD.SrcAddr, Cmd->BD.Length);
+			Ranges[NumRanges].Addr = Cmd->BD.SrcAddr;
+			Ranges[NumRanges].Len = Cmd->BD.Length;
+			NumRanges++;
+		}
+		if (NumRanges != 0) {
+			Xil_DCacheFlushRangeV(Ranges, NumRanges);
 		}
 		if (Cmd->ChanCtrl.DstInc) {
 			Xil_DCacheInvalidateRange(Cmd->BD.DstAddr,
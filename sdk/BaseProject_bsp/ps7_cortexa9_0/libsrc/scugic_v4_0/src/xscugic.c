@@ -124,6 +124,10 @@
 * 3.10  mus  09/19/18 Fix cppcheck warnings
 * 4.0   mus  11/22/18 Fixed bugs in software interrupt generation through 
 *                      XScuGic_SoftwareIntr API
+* 4.0   bk   10/17/26 Added XScuGic_EnableMask, XScuGic_DisableMask and
+*                     XScuGic_SetPriorityTriggerTypeMask to configure several
+*                     interrupt sources with one write per register.
+* 4.0   bk   10/17/26 XScuGic_CfgInitialize clears the dispatch counters.
 * </pre>
 *
 ******************************************************************************/
@@ -440,6 +444,11 @@ s32  XScuGic_CfgInitialize(XScuGic *InstancePtr,
 
 		InstancePtr->IsReady = 0U;
 		InstancePtr->Config = ConfigPtr;
+		InstancePtr->SpuriousInterrupts = 0U;
+		for (Int_Id = 0U; Int_Id < XSCUGIC_MAX_NUM_INTR_INPUTS;
+				Int_Id++) {
+			InstancePtr->DispatchCount[Int_Id] = 0U;
+		}
 
 
 		for (Int_Id = 0U; Int_Id < XSCUGIC_MAX_NUM_INTR_INPUTS;
@@ -681,6 +690,95 @@ void XScuGic_Disable(XScuGic *InstancePtr, u32 Int_Id)
 						((Int_Id / 32U) * 4U), Mask);
 }
 
+/*****************************************************************************/
+/**
+*
+* Enables all interrupt sources selected in the MaskPtr bitmap. Bit n of
+* MaskPtr[w] selects Int_Id (w * 32) + n. Each Enable Set register is written
+* at most once, so enabling a group of sources costs one bus write per 32
+* sources instead of one per source.
+*
+* @param	InstancePtr is a pointer to the XScuGic instance.
+* @param	MaskPtr is a pointer to XSCUGIC_INTR_MASK_WORDS words of
+*		interrupt source bits.
+*
+* @return	None.
+*
+* @note		The Enable Set register is write-1-to-set, zero bits leave
+*		the other sources untouched.
+*
+****************************************************************************/
+void XScuGic_EnableMask(XScuGic *InstancePtr, const u32 *MaskPtr)
+{
+	u32 Index;
+	u32 Mask;
+
+	/*
+	 * Assert the arguments
+	 */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(MaskPtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	for (Index = 0U; Index < XSCUGIC_INTR_MASK_WORDS; Index++) {
+		Mask = MaskPtr[Index];
+#if defined (versal) && !defined(ARMR5)
+		if (Index == 0U) {
+			/*
+			 * SGI and PPI enables live in the redistributor
+			 */
+			if (Mask != 0U) {
+				Mask |= XScuGic_ReDistSGIPPIReadReg(InstancePtr,
+					XSCUGIC_RDIST_ISENABLE_OFFSET);
+				XScuGic_ReDistSGIPPIWriteReg(InstancePtr,
+					XSCUGIC_RDIST_ISENABLE_OFFSET, Mask);
+			}
+			continue;
+		}
+#endif
+		if (Mask != 0U) {
+			XScuGic_DistWriteReg(InstancePtr,
+				(u32)XSCUGIC_ENABLE_SET_OFFSET + (Index * 4U), Mask);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Disables all interrupt sources selected in the MaskPtr bitmap. Bit n of
+* MaskPtr[w] selects Int_Id (w * 32) + n. Each Enable Clear register is
+* written at most once.
+*
+* @param	InstancePtr is a pointer to the XScuGic instance.
+* @param	MaskPtr is a pointer to XSCUGIC_INTR_MASK_WORDS words of
+*		interrupt source bits.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+void XScuGic_DisableMask(XScuGic *InstancePtr, const u32 *MaskPtr)
+{
+	u32 Index;
+
+	/*
+	 * Assert the arguments
+	 */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(MaskPtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	for (Index = 0U; Index < XSCUGIC_INTR_MASK_WORDS; Index++) {
+		if (MaskPtr[Index] != 0U) {
+			XScuGic_DistWriteReg(InstancePtr,
+				(u32)XSCUGIC_DISABLE_OFFSET + (Index * 4U),
+				MaskPtr[Index]);
+		}
+	}
+}
+
 /*****************************************************************************/
 /**
 *
@@ -867,6 +965,123 @@ void XScuGic_SetPriorityTriggerType(XScuGic *InstancePtr, u32 Int_Id,
 
 }
 
+/****************************************************************************/
+/**
+* Sets the same priority and trigger type for all interrupt sources selected
+* in the MaskPtr bitmap. Each priority register (4 sources) and each
+* configuration register (16 sources) touched by the bitmap is read and
+* written once, a priority register whose 4 sources are all selected is
+* written without reading it first.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	MaskPtr is a pointer to XSCUGIC_INTR_MASK_WORDS words of
+*		interrupt source bits, bit n of MaskPtr[w] selects
+*		Int_Id (w * 32) + n.
+* @param	Priority is the new priority for the IRQ sources, see
+*		XScuGic_SetPriorityTriggerType.
+* @param	Trigger is the new trigger type for the IRQ sources, see
+*		XScuGic_SetPriorityTriggerType. Only SPIs are written.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XScuGic_SetPriorityTriggerTypeMask(XScuGic *InstancePtr,
+				const u32 *MaskPtr, u8 Priority, u8 Trigger)
+{
+	u32 RegValue;
+	u32 Bits;
+	u32 ByteMask;
+	u32 FieldMask;
+	u32 PriorityValue;
+	u32 TriggerValue;
+	u32 Int_Id;
+	u32 Index;
+	u32 Bit;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(MaskPtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(Trigger <= (u8)XSCUGIC_INT_CFG_MASK);
+	Xil_AssertVoid(Priority <= (u8)XSCUGIC_MAX_INTR_PRIO_VAL);
+
+	/*
+	 * Replicate the masked priority in all 4 bytes and the trigger in all
+	 * 16 bit pairs so the selected fields can be picked with one AND.
+	 */
+	PriorityValue = (u32)(Priority & (u8)XSCUGIC_INTR_PRIO_MASK) *
+				0x01010101U;
+	TriggerValue = (u32)Trigger * 0x55555555U;
+
+	for (Index = 0U; Index < XSCUGIC_INTR_MASK_WORDS; Index++) {
+		Bits = MaskPtr[Index];
+#if defined (versal) && !defined(ARMR5)
+		if (Index == 0U) {
+			/*
+			 * SGI and PPI configuration lives in the redistributor
+			 */
+			for (Int_Id = 0U; Bits != 0U; Int_Id++, Bits >>= 1U) {
+				if ((Bits & 1U) != 0U) {
+					XScuGic_SetPriorityTriggerType(InstancePtr,
+						Int_Id, Priority, Trigger);
+				}
+			}
+			continue;
+		}
+#endif
+		/*
+		 * One priority register per 4 sources
+		 */
+		for (Int_Id = Index * 32U; Bits != 0U; Int_Id += 4U, Bits >>= 4U) {
+			if ((Bits & 0xFU) == 0U) {
+				continue;
+			}
+			ByteMask = (((Bits >> 0U) & 1U) * 0x000000FFU) |
+				   (((Bits >> 1U) & 1U) * 0x0000FF00U) |
+				   (((Bits >> 2U) & 1U) * 0x00FF0000U) |
+				   (((Bits >> 3U) & 1U) * 0xFF000000U);
+			if (ByteMask == 0xFFFFFFFFU) {
+				RegValue = PriorityValue;
+			} else {
+				RegValue = XScuGic_DistReadReg(InstancePtr,
+					XSCUGIC_PRIORITY_OFFSET_CALC(Int_Id));
+				RegValue = (RegValue & ~ByteMask) |
+					   (PriorityValue & ByteMask);
+			}
+			XScuGic_DistWriteReg(InstancePtr,
+				XSCUGIC_PRIORITY_OFFSET_CALC(Int_Id), RegValue);
+		}
+
+		/*
+		 * One configuration register per 16 sources, SGI and PPI
+		 * configuration is read only
+		 */
+		Bits = MaskPtr[Index];
+		if (Index == 0U) {
+			continue;
+		}
+		for (Int_Id = Index * 32U; Bits != 0U; Int_Id += 16U, Bits >>= 16U) {
+			if ((Bits & 0xFFFFU) == 0U) {
+				continue;
+			}
+			FieldMask = 0U;
+			for (Bit = 0U; Bit < 16U; Bit++) {
+				if ((Bits & (1U << Bit)) != 0U) {
+					FieldMask |= XSCUGIC_INT_CFG_MASK <<
+							(Bit * 2U);
+				}
+			}
+			RegValue = XScuGic_DistReadReg(InstancePtr,
+					XSCUGIC_INT_CFG_OFFSET_CALC(Int_Id));
+			RegValue = (RegValue & ~FieldMask) |
+				   (TriggerValue & FieldMask);
+			XScuGic_DistWriteReg(InstancePtr,
+				XSCUGIC_INT_CFG_OFFSET_CALC(Int_Id), RegValue);
+		}
+	}
+}
+
 /****************************************************************************/
 /**
 * Gets the interrupt priority and trigger type for the specificd IRQ source.
@@ -62,6 +62,9 @@
 *                     reported by coverity tool. It fixes CR#1006344.
 * 3.10  mus  07/17/18 Updated file to fix the various coding style issues
 *                     reported by checkpatch. It fixes CR#1006344.
+* 4.0   bk   10/17/26 Added XScuGic_InterruptHandlerChained, which services
+*                     every pending interrupt in one exception, and the
+*                     per Int_Id dispatch counter APIs.
 *
 * </pre>
 *
@@ -84,6 +87,12 @@
 
 /************************** Constant Definitions *****************************/
 
+/*
+ * Int_Ack values from this ID on are special (1020 - 1023), 1023 means no
+ * interrupt is pending. They must not be written back to the EOI register.
+ */
+#define XSCUGIC_SPECIAL_INTR_ID_START	1020U
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -182,4 +191,123 @@ IntrExit:
 	     * could happen here.
 	     */
 }
+
+/*****************************************************************************/
+/**
+* This function is a high throughput replacement for XScuGic_InterruptHandler.
+* It is connected the same way. After each interrupt is ended it reads the
+* int_ack register again, so interrupts that became pending while a handler
+* ran are serviced without taking another exception. It returns when the
+* int_ack register reads a spurious ID.
+*
+* Handlers are called through Config->HandlerTable, where XScuGic_Connect
+* and the low level XScuGic_RegisterHandler put them. Each call is counted in
+* DispatchCount[Int_Id], an entry that found nothing pending is counted in
+* SpuriousInterrupts.
+*
+* @param	InstancePtr is a pointer to the XScuGic instance.
+*
+* @return	None.
+*
+* @note		A source that keeps its interrupt asserted keeps this function
+*		looping, with the same priority rules as the single interrupt
+*		handler.
+*
+******************************************************************************/
+void XScuGic_InterruptHandlerChained(XScuGic *InstancePtr)
+{
+	u32 InterruptID;
+	u32 IntIDFull;
+	u32 Dispatched = 0U;
+	XScuGic_VectorTableEntry *TablePtr;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	TablePtr = InstancePtr->Config->HandlerTable;
+
+	for (;;) {
+		/*
+		 * Reading Int_Ack acknowledges the highest priority pending
+		 * interrupt.
+		 */
+#if defined (versal) && !defined(ARMR5)
+		IntIDFull = XScuGic_get_IntID();
+#else
+		IntIDFull = XScuGic_CPUReadReg(InstancePtr,
+						XSCUGIC_INT_ACK_OFFSET);
+#endif
+		InterruptID = IntIDFull & XSCUGIC_ACK_INTID_MASK;
+		if (InterruptID >= XSCUGIC_SPECIAL_INTR_ID_START) {
+			break;
+		}
+
+		if (InterruptID < XSCUGIC_MAX_NUM_INTR_INPUTS) {
+			InstancePtr->DispatchCount[InterruptID]++;
+			TablePtr[InterruptID].Handler(
+					TablePtr[InterruptID].CallBackRef);
+		}
+		Dispatched++;
+
+		/*
+		 * End the interrupt with the full Int_Ack value, for SGIs it
+		 * holds the source CPU as well.
+		 */
+#if defined (versal) && !defined(ARMR5)
+		XScuGic_ack_Int(IntIDFull);
+#else
+		XScuGic_CPUWriteReg(InstancePtr, XSCUGIC_EOI_OFFSET, IntIDFull);
+#endif
+	}
+
+	if (Dispatched == 0U) {
+		InstancePtr->SpuriousInterrupts++;
+	}
+}
+
+/*****************************************************************************/
+/**
+* Returns the number of handler calls XScuGic_InterruptHandlerChained made
+* for an interrupt source since initialization or the last
+* XScuGic_ClearDispatchCounts.
+*
+* @param	InstancePtr is a pointer to the XScuGic instance.
+* @param	Int_Id contains the ID of the interrupt source and should be
+*		in the range of 0 to XSCUGIC_MAX_NUM_INTR_INPUTS - 1
+*
+* @return	The dispatch count of Int_Id.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XScuGic_GetDispatchCount(XScuGic *InstancePtr, u32 Int_Id)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Int_Id < XSCUGIC_MAX_NUM_INTR_INPUTS);
+
+	return InstancePtr->DispatchCount[Int_Id];
+}
+
+/*****************************************************************************/
+/**
+* Clears the per Int_Id dispatch counts and the spurious interrupt count.
+*
+* @param	InstancePtr is a pointer to the XScuGic instance.
+*
+* @return	None.
+*
+* @note		Counts updated by an interrupt taken during the clear may be
+*		kept.
+*
+******************************************************************************/
+void XScuGic_ClearDispatchCounts(XScuGic *InstancePtr)
+{
+	u32 Int_Id;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	for (Int_Id = 0U; Int_Id < XSCUGIC_MAX_NUM_INTR_INPUTS; Int_Id++) {
+		InstancePtr->DispatchCount[Int_Id] = 0U;
+	}
+	InstancePtr->SpuriousInterrupts = 0U;
+}
 /** @} */
@@ -96,6 +96,8 @@
 *       mus    11/05/18 Support 64 bit DMA addresses for Microblaze-X platform.
 * 3.7   mn     02/01/19 Add support for idling of SDIO
 *       aru    03/12/19 Modified the code according to MISRAC-2012.
+*       bk     10/17/26 Flush the ADMA2 table and the buffer of WritePolled
+*                       with one Xil_DCacheFlushRangeV call.
 * </pre>
 *
 ******************************************************************************/
@@ -139,6 +141,8 @@
 u32 XSdPs_FrameCmd(XSdPs *InstancePtr, u32 Cmd);
 s32 XSdPs_CmdTransfer(XSdPs *InstancePtr, u32 Cmd, u32 Arg, u32 BlkCnt);
 void XSdPs_SetupADMA2DescTbl(XSdPs *InstancePtr, u32 BlkCnt, const u8 *Buff);
+static void XSdPs_FillADMA2DescTbl(XSdPs *InstancePtr, u32 BlkCnt,
+		const u8 *Buff);
 void XSdPs_SetupADMA2DescTbl64Bit(XSdPs *InstancePtr, u32 BlkCnt);
 extern s32 XSdPs_Uhs_ModeInit(XSdPs *InstancePtr, u8 Mode);
 static s32 XSdPs_IdentifyCard(XSdPs *InstancePtr);
@@ -1484,10 +1488,16 @@ s32 XSdPs_WritePolled(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, const u8 *Buff)
 	if (InstancePtr->Dma64BitAddr >= ADDRESS_BEYOND_32BIT) {
 		XSdPs_SetupADMA2DescTbl64Bit(InstancePtr, BlkCnt);
 	} else {
-		XSdPs_SetupADMA2DescTbl(InstancePtr, BlkCnt, Buff);
+		XSdPs_FillADMA2DescTbl(InstancePtr, BlkCnt, Buff);
 		if (InstancePtr->Config.IsCacheCoherent == 0U) {
-			Xil_DCacheFlushRange((INTPTR)Buff,
-				BlkCnt * XSDPS_BLK_SIZE_512_MASK);
+			/* Descriptor table and data in one pass */
+			Xil_DCacheRange Ranges[2];
+
+			Ranges[0].Addr = (INTPTR)&(InstancePtr->Adma2_DescrTbl[0]);
+			Ranges[0].Len = sizeof(XSdPs_Adma2Descriptor) * 32U;
+			Ranges[1].Addr = (INTPTR)Buff;
+			Ranges[1].Len = BlkCnt * XSDPS_BLK_SIZE_512_MASK;
+			Xil_DCacheFlushRangeV(Ranges, 2U);
 		}
 	}
 
@@ -1658,6 +1668,33 @@ void XSdPs_SetupADMA2DescTbl64Bit(XSdPs *InstancePtr, u32 BlkCnt)
 *
 ******************************************************************************/
 void XSdPs_SetupADMA2DescTbl(XSdPs *InstancePtr, u32 BlkCnt, const u8 *Buff)
+{
+	XSdPs_FillADMA2DescTbl(InstancePtr, BlkCnt, Buff);
+
+	if (InstancePtr->Config.IsCacheCoherent == 0U) {
+		Xil_DCacheFlushRange((INTPTR)&(InstancePtr->Adma2_DescrTbl[0]),
+			sizeof(XSdPs_Adma2Descriptor) * 32U);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Write the ADMA2 descriptor table and point ADMA SAR to it. The table is
+* not flushed from the data cache, the caller does it.
+*
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+* @param	BlkCnt - block count.
+* @param	Buff pointer to data buffer.
+*
+* @return	None
+*
+* @note		None.
+*
+******************************************************************************/
+static void XSdPs_FillADMA2DescTbl(XSdPs *InstancePtr, u32 BlkCnt,
+		const u8 *Buff)
 {
 	u32 TotalDescLines;
 	u64 DescNum;
@@ -1715,11 +1752,6 @@ void XSdPs_SetupADMA2DescTbl(XSdPs *InstancePtr, u32 BlkCnt, const u8 *Buff)
 
 	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_ADMA_SAR_OFFSET,
 			(u32)(UINTPTR)&(InstancePtr->Adma2_DescrTbl[0]));
-
-	if (InstancePtr->Config.IsCacheCoherent == 0U) {
-		Xil_DCacheFlushRange((INTPTR)&(InstancePtr->Adma2_DescrTbl[0]),
-			sizeof(XSdPs_Adma2Descriptor) * 32U);
-	}
 }
 
 /*****************************************************************************/
@@ -1,5 +1,8 @@
 #include "xparameters.h"
 #include "xuartps_hw.h"
+#include "xil_printf.h"
+#include "xpseudo_asm.h"
+#include "xreg_cortexa9.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -10,6 +13,183 @@ void outbyte(char c);
 }
 #endif 
 
+#if STDOUT_BUFFERED
+
+/*
+ * Buffered stdout. Characters are queued in a RAM ring and the UART TX FIFO
+ * is refilled from XStdout_InterruptHandler on the TX empty interrupt, so a
+ * print costs a copy into RAM instead of the serial transmit time. The
+ * application connects XStdout_InterruptHandler to the interrupt of the
+ * STDOUT UART.
+ *
+ * The STDOUT UART is owned by this code. The handler enables and disables
+ * TX empty and clears it in the ISR, a second driver on the same UART would
+ * clear or mask it under the handler and stall the ring. Drive other
+ * traffic through the other UART.
+ */
+#define STDOUT_IRQ_FIQ_MASK	(XREG_CPSR_IRQ_ENABLE | XREG_CPSR_FIQ_ENABLE)
+#define STDOUT_BUFFER_INDEX_MASK	(STDOUT_BUFFER_SIZE - 1U)
+
+#if ((STDOUT_BUFFER_SIZE & STDOUT_BUFFER_INDEX_MASK) != 0U)
+#error "STDOUT_BUFFER_SIZE must be a power of 2"
+#endif
+
+static u8 StdoutBuffer[STDOUT_BUFFER_SIZE];
+static volatile u32 StdoutHead;	/* next free slot, written by outbyte */
+static volatile u32 StdoutTail;	/* next byte to send, written by the drain */
+static u32 StdoutPolicy = XSTDOUT_POLICY_DROP;
+static u32 StdoutDropCount;
+
+/*
+ * Move queued bytes into the TX FIFO until it is full or the ring is empty.
+ * Called with IRQ/FIQ masked or from the interrupt handler.
+ */
+static void XStdout_FillFifo(void)
+{
+	while ((StdoutTail != StdoutHead) &&
+		(XUartPs_IsTransmitFull(STDOUT_BASEADDRESS) == FALSE)) {
+		XUartPs_WriteReg(STDOUT_BASEADDRESS, XUARTPS_FIFO_OFFSET,
+			(u32)StdoutBuffer[StdoutTail & STDOUT_BUFFER_INDEX_MASK]);
+		StdoutTail++;
+	}
+}
+
+void outbyte(char c) {
+	u32 currmask;
+
+	currmask = mfcpsr();
+	mtcpsr(currmask | STDOUT_IRQ_FIQ_MASK);
+
+	/* Nothing queued and room in the FIFO, no need to go through the ring */
+	if ((StdoutTail == StdoutHead) &&
+		(XUartPs_IsTransmitFull(STDOUT_BASEADDRESS) == FALSE)) {
+		XUartPs_WriteReg(STDOUT_BASEADDRESS, XUARTPS_FIFO_OFFSET, (u32)c);
+		mtcpsr(currmask);
+		return;
+	}
+
+	if ((StdoutHead - StdoutTail) >= STDOUT_BUFFER_SIZE) {
+		if (StdoutPolicy == XSTDOUT_POLICY_DROP) {
+			StdoutDropCount++;
+			mtcpsr(currmask);
+			return;
+		}
+		/*
+		 * Block: make room by polling the oldest byte out. This does not
+		 * rely on the interrupt, so it also works with IRQs masked.
+		 */
+		while (XUartPs_IsTransmitFull(STDOUT_BASEADDRESS) == TRUE) {
+			;
+		}
+		XStdout_FillFifo();
+	}
+
+	StdoutBuffer[StdoutHead & STDOUT_BUFFER_INDEX_MASK] = (u8)c;
+	StdoutHead++;
+
+	XUartPs_WriteReg(STDOUT_BASEADDRESS, XUARTPS_IER_OFFSET,
+			XUARTPS_IXR_TXEMPTY);
+
+	mtcpsr(currmask);
+}
+
+/*****************************************************************************/
+/**
+*
+* TX empty interrupt handler of the buffered stdout. Refills the TX FIFO
+* from the ring and disables the TX empty interrupt once the ring is empty.
+*
+* @param	CallBackRef is unused.
+*
+* @return	None.
+*
+* @note		Only the TX empty status is handled and cleared. This must be
+*		the only handler of the STDOUT UART interrupt, keep the other
+*		interrupts of that UART disabled.
+*
+******************************************************************************/
+void XStdout_InterruptHandler(void *CallBackRef)
+{
+	(void)CallBackRef;
+
+	if ((XUartPs_ReadReg(STDOUT_BASEADDRESS, XUARTPS_ISR_OFFSET) &
+		XUARTPS_IXR_TXEMPTY) == 0U) {
+		return;
+	}
+	XUartPs_WriteReg(STDOUT_BASEADDRESS, XUARTPS_ISR_OFFSET,
+			XUARTPS_IXR_TXEMPTY);
+
+	XStdout_FillFifo();
+
+	if (StdoutTail == StdoutHead) {
+		XUartPs_WriteReg(STDOUT_BASEADDRESS, XUARTPS_IDR_OFFSET,
+				XUARTPS_IXR_TXEMPTY);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Send everything queued by polling and wait until the last character has
+* left the transmitter: TX FIFO empty and the shift register idle. TXEMPTY
+* alone is set while the last character is still being shifted out. Does not
+* depend on interrupts, so it can be used on panic and reset paths.
+*
+* @return	None.
+*
+******************************************************************************/
+void XStdout_Flush(void)
+{
+	u32 currmask;
+
+	currmask = mfcpsr();
+	mtcpsr(currmask | STDOUT_IRQ_FIQ_MASK);
+
+	while (StdoutTail != StdoutHead) {
+		XStdout_FillFifo();
+	}
+	XUartPs_WriteReg(STDOUT_BASEADDRESS, XUARTPS_IDR_OFFSET,
+			XUARTPS_IXR_TXEMPTY);
+
+	while ((XUartPs_ReadReg(STDOUT_BASEADDRESS, XUARTPS_SR_OFFSET) &
+		(XUARTPS_SR_TXEMPTY | XUARTPS_SR_TACTIVE)) != XUARTPS_SR_TXEMPTY) {
+		;
+	}
+
+	mtcpsr(currmask);
+}
+
+/*****************************************************************************/
+/**
+*
+* Select what outbyte does when the ring is full.
+*
+* @param	Policy is XSTDOUT_POLICY_DROP to discard the character or
+*		XSTDOUT_POLICY_BLOCK to poll room free in the TX FIFO.
+*
+* @return	None.
+*
+******************************************************************************/
+void XStdout_SetPolicy(u32 Policy)
+{
+	StdoutPolicy = Policy;
+}
+
+/*****************************************************************************/
+/**
+*
+* @return	Number of characters discarded because the ring was full.
+*
+******************************************************************************/
+u32 XStdout_GetDropCount(void)
+{
+	return StdoutDropCount;
+}
+
+#else
+
 void outbyte(char c) {
 	 XUartPs_SendByte(STDOUT_BASEADDRESS, c);
 }
+
+#endif
@@ -94,6 +94,19 @@
 * 6.6    asa 16/01/18 Changes made in Xil_L1DCacheInvalidate and Xil_L2CacheInvalidate
 *					  routines to ensure the stack data flushed only when the respective
 *					  caches are enabled. This fixes CR-992023.
+* 7.0    bk  10/17/26 Xil_DCacheInvalidateRange and Xil_DCacheFlushRange work in
+*					  chunks of XIL_CACHE_RANGE_CHUNK_SIZE bytes with IRQ/FIQ masked
+*					  only inside a chunk. L2 cache sync is issued once per chunk for
+*					  invalidation and once per range for flush instead of per line.
+* 7.0    bk  10/17/26 Xil_DCacheFlushRange flushes the whole data cache for ranges
+*					  from the flush threshold on. Added threshold calibration and
+*					  range/full flush counters.
+* 7.0    bk  10/17/26 Added Xil_DCacheFlushRangeV and Xil_DCacheInvalidateRangeV
+*					  for lists of ranges.
+* 7.0    bk  10/17/26 Xil_DCacheCalibrateFlushThreshold makes the range dirty
+*					  before both timed flushes and times them with IRQ/FIQ
+*					  masked, a clean range made the line by line flush look
+*					  cheaper than it is.
 *
 * </pre>
 *
@@ -110,6 +123,7 @@
 #include "xl2cc.h"
 #include "xil_errata.h"
 #include "xil_exception.h"
+#include "xtime_l.h"
 
 /************************** Function Prototypes ******************************/
 
@@ -117,6 +131,20 @@
 
 #define IRQ_FIQ_MASK 0xC0U	/* Mask IRQ and FIQ interrupts in cpsr */
 
+/*
+ * Xil_DCacheFlushRange flushes the whole data cache for ranges of this many
+ * bytes and above, set/way and L2 way operations cost the same for any range
+ * while the line by line walk grows with it. 0 keeps every range line by line.
+ * Default is the L2 cache size, Xil_DCacheCalibrateFlushThreshold measures it.
+ */
+#ifndef XIL_CACHE_FLUSH_FULL_THRESHOLD
+#define XIL_CACHE_FLUSH_FULL_THRESHOLD	(512U * 1024U)
+#endif
+#define XIL_CACHE_CALIBRATE_MIN_SIZE	(16U * 1024U)
+
+static u32 FlushFullThreshold = XIL_CACHE_FLUSH_FULL_THRESHOLD;
+static Xil_DCacheFlushStats FlushStats;
+
 #ifdef __GNUC__
 	extern s32  _stack_end;
 	extern s32  __undef_stack;
@@ -167,6 +195,113 @@ static void Xil_L2CacheSync(void)
 	Xil_Out32(XPS_L2CC_BASEADDR + XPS_L2CC_CACHE_SYNC_OFFSET, 0x0U);
 }
 #endif
+
+/****************************************************************************
+*
+* Flush the Data cache lines in [adr, end) from L1 and then from L2. No L2
+* cache sync is issued, the caller syncs once after all lines.
+*
+* @param	adr: Cache line aligned start address.
+* @param	end: End address, exclusive.
+*
+* @return	None.
+*
+* @note		Called with IRQ/FIQ masked.
+*
+****************************************************************************/
+static void Xil_DCacheFlushLines(u32 adr, u32 end)
+{
+	const u32 cacheline = 32U;
+	u32 LocalAddr;
+#ifndef USE_AMP
+	volatile u32 *L2CCOffset = (volatile u32 *)(XPS_L2CC_BASEADDR +
+				    XPS_L2CC_CACHE_INV_CLN_PA_OFFSET);
+#endif
+
+	for (LocalAddr = adr; LocalAddr < end; LocalAddr += cacheline) {
+	/* Flush L1 Data cache line */
+#if defined (__GNUC__) || defined (__ICCARM__)
+		asm_cp15_clean_inval_dc_line_mva_poc(LocalAddr);
+#else
+		{ volatile register u32 Reg
+			__asm(XREG_CP15_CLEAN_INVAL_DC_LINE_MVA_POC);
+		  Reg = LocalAddr; }
+#endif
+	}
+#ifndef USE_AMP
+	/* L1 write backs reach L2 before L2 is flushed */
+	dsb();
+	for (LocalAddr = adr; LocalAddr < end; LocalAddr += cacheline) {
+		/* Flush L2 cache line */
+		*L2CCOffset = LocalAddr;
+	}
+#endif
+}
+
+/****************************************************************************
+*
+* Invalidate the Data cache lines in [adr, end) in L2 and then in L1. L2 is
+* synced before L1 is invalidated, so that L1 cannot refill the lines from
+* stale L2 data.
+*
+* @param	adr: Cache line aligned start address.
+* @param	end: End address, exclusive.
+*
+* @return	None.
+*
+* @note		Called with IRQ/FIQ masked.
+*
+****************************************************************************/
+static void Xil_DCacheInvalidateLines(u32 adr, u32 end)
+{
+	const u32 cacheline = 32U;
+	u32 LocalAddr;
+#ifndef USE_AMP
+	volatile u32 *L2CCOffset = (volatile u32 *)(XPS_L2CC_BASEADDR +
+				    XPS_L2CC_CACHE_INVLD_PA_OFFSET);
+
+	for (LocalAddr = adr; LocalAddr < end; LocalAddr += cacheline) {
+		/* Invalidate L2 cache line */
+		*L2CCOffset = LocalAddr;
+	}
+	Xil_L2CacheSync();
+#endif
+	for (LocalAddr = adr; LocalAddr < end; LocalAddr += cacheline) {
+	/* Invalidate L1 Data cache line */
+#if defined (__GNUC__) || defined (__ICCARM__)
+		asm_cp15_inval_dc_line_mva_poc(LocalAddr);
+#else
+		{ volatile register u32 Reg
+			__asm(XREG_CP15_INVAL_DC_LINE_MVA_POC);
+		  Reg = LocalAddr; }
+#endif
+	}
+}
+
+/****************************************************************************
+*
+* Flush the partial cache line at either end of a range that is invalidated,
+* other data sharing the line is written back instead of being lost. No L2
+* cache sync is issued.
+*
+* @param	adr: Cache line aligned address.
+*
+* @return	None.
+*
+* @note		Called with IRQ/FIQ masked.
+*
+****************************************************************************/
+static void Xil_DCacheFlushEdgeLine(u32 adr)
+{
+	Xil_L1DCacheFlushLine(adr);
+#ifndef USE_AMP
+	/* Disable Write-back and line fills */
+	Xil_L2WriteDebugCtrl(0x3U);
+	Xil_L2CacheFlushLine(adr);
+	/* Enable Write-back and line fills */
+	Xil_L2WriteDebugCtrl(0x0U);
+#endif
+}
 /****************************************************************************/
 /**
 * @brief	Enable the Data cache.
@@ -332,9 +467,8 @@ void Xil_DCacheInvalidateRange(INTPTR adr, u32 len)
 	u32 end;
 	u32 tempadr = adr;
 	u32 tempend;
+	u32 chunkend;
 	u32 currmask;
-	volatile u32 *L2CCOffset = (volatile u32 *)(XPS_L2CC_BASEADDR +
-				    XPS_L2CC_CACHE_INVLD_PA_OFFSET);
 
 	currmask = mfcpsr();
 	mtcpsr(currmask | IRQ_FIQ_MASK);
@@ -347,53 +481,34 @@ void Xil_DCacheInvalidateRange(INTPTR adr, u32 len)
 
 		if ((tempadr & (cacheline-1U)) != 0U) {
 			tempadr &= (~(cacheline - 1U));
-
-			Xil_L1DCacheFlushLine(tempadr);
-#ifndef USE_AMP
-			/* Disable Write-back and line fills */
-			Xil_L2WriteDebugCtrl(0x3U);
-			Xil_L2CacheFlushLine(tempadr);
-			/* Enable Write-back and line fills */
-			Xil_L2WriteDebugCtrl(0x0U);
-			Xil_L2CacheSync();
-#endif
+			Xil_DCacheFlushEdgeLine(tempadr);
 			tempadr += cacheline;
 		}
 		if ((tempend & (cacheline-1U)) != 0U) {
 			tempend &= (~(cacheline - 1U));
-
-			Xil_L1DCacheFlushLine(tempend);
-#ifndef USE_AMP
-			/* Disable Write-back and line fills */
-			Xil_L2WriteDebugCtrl(0x3U);
-			Xil_L2CacheFlushLine(tempend);
-			/* Enable Write-back and line fills */
-			Xil_L2WriteDebugCtrl(0x0U);
-			Xil_L2CacheSync();
-#endif
+			Xil_DCacheFlushEdgeLine(tempend);
 		}
-
-		while (tempadr < tempend) {
 #ifndef USE_AMP
-			/* Invalidate L2 cache line */
-			*L2CCOffset = tempadr;
-			Xil_L2CacheSync();
+		Xil_L2CacheSync();
 #endif
+		mtcpsr(currmask);
 
-	/* Invalidate L1 Data cache line */
-#if defined (__GNUC__) || defined (__ICCARM__)
-			asm_cp15_inval_dc_line_mva_poc(tempadr);
-#else
-			{ volatile register u32 Reg
-				__asm(XREG_CP15_INVAL_DC_LINE_MVA_POC);
-			  Reg = tempadr; }
-#endif
-			tempadr += cacheline;
+		while (tempadr < tempend) {
+			chunkend = tempadr + XIL_CACHE_RANGE_CHUNK_SIZE;
+			if ((chunkend > tempend) || (chunkend < tempadr)) {
+				chunkend = tempend;
+			}
+
+			mtcpsr(currmask | IRQ_FIQ_MASK);
+			Xil_DCacheInvalidateLines(tempadr, chunkend);
+			mtcpsr(currmask);
+			tempadr = chunkend;
 		}
+	} else {
+		mtcpsr(currmask);
 	}
 
 	dsb();
-	mtcpsr(currmask);
 }
 
 /****************************************************************************/
@@ -469,7 +584,9 @@ void Xil_DCacheFlushLine(u32 adr)
 *
 * @return	None.
 *
-* @note		None.
+* @note		Ranges from the flush threshold on are handled by
+*			Xil_DCacheFlush, which flushes the other cached data as well and
+*			keeps IRQ/FIQ masked while it runs.
 *
 ****************************************************************************/
 void Xil_DCacheFlushRange(INTPTR adr, u32 len)
@@ -477,12 +594,17 @@ void Xil_DCacheFlushRange(INTPTR adr, u32 len)
 	u32 LocalAddr = adr;
 	const u32 cacheline = 32U;
 	u32 end;
+	u32 chunkend;
 	u32 currmask;
-	volatile u32 *L2CCOffset = (volatile u32 *)(XPS_L2CC_BASEADDR +
-				    XPS_L2CC_CACHE_INV_CLN_PA_OFFSET);
+
+	if ((FlushFullThreshold != 0U) && (len >= FlushFullThreshold)) {
+		FlushStats.FullFlushCount++;
+		Xil_DCacheFlush();
+		return;
+	}
+	FlushStats.RangeFlushCount++;
 
 	currmask = mfcpsr();
-	mtcpsr(currmask | IRQ_FIQ_MASK);
 
 	if (len != 0U) {
 		/* Back the starting address up to the start of a cache line
@@ -492,25 +614,371 @@ void Xil_DCacheFlushRange(INTPTR adr, u32 len)
 		LocalAddr &= ~(cacheline - 1U);
 
 		while (LocalAddr < end) {
+			chunkend = LocalAddr + XIL_CACHE_RANGE_CHUNK_SIZE;
+			if ((chunkend > end) || (chunkend < LocalAddr)) {
+				chunkend = end;
+			}
+
+			mtcpsr(currmask | IRQ_FIQ_MASK);
+			Xil_DCacheFlushLines(LocalAddr, chunkend);
+			mtcpsr(currmask);
+			LocalAddr = chunkend;
+		}
+#ifndef USE_AMP
+		/* One sync drains the L2 line operations of all chunks */
+		Xil_L2CacheSync();
+#endif
+	}
+	dsb();
+}
 
-	/* Flush L1 Data cache line */
-#if defined (__GNUC__) || defined (__ICCARM__)
-			asm_cp15_clean_inval_dc_line_mva_poc(LocalAddr);
-#else
-			{ volatile register u32 Reg
-				__asm(XREG_CP15_CLEAN_INVAL_DC_LINE_MVA_POC);
-			  Reg = LocalAddr; }
+/****************************************************************************/
+/**
+* @brief	Set the range size from which Xil_DCacheFlushRange flushes the
+* 			entire Data cache instead of the range.
+*
+* @param	Threshold: Range size in bytes, 0 disables full flushes.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+void Xil_DCacheSetFlushThreshold(u32 Threshold)
+{
+	FlushFullThreshold = Threshold;
+}
+
+/****************************************************************************/
+/**
+* @brief	Get the range size from which Xil_DCacheFlushRange flushes the
+* 			entire Data cache.
+*
+* @param	None.
+*
+* @return	Threshold in bytes, 0 if full flushes are disabled.
+*
+* @note		None.
+*
+****************************************************************************/
+u32 Xil_DCacheGetFlushThreshold(void)
+{
+	return FlushFullThreshold;
+}
+
+/****************************************************************************
+*
+* Make the Data cache lines of a range dirty by rewriting the first word of
+* each line with its own value.
+*
+* @param	adr: Cache line aligned start address.
+* @param	len: Length in bytes.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+static void Xil_DCacheDirtyRange(INTPTR adr, u32 len)
+{
+	const u32 cacheline = 32U;
+	volatile u32 *Word;
+	u32 LocalAddr;
+
+	for (LocalAddr = adr; LocalAddr < (adr + len); LocalAddr += cacheline) {
+		Word = (volatile u32 *)LocalAddr;
+		*Word = *Word;
+	}
+	dsb();
+}
+
+/****************************************************************************/
+/**
+* @brief	Measure the flush threshold and set it. For each range size from
+* 			16 KB on, doubling up to maxlen, the range is made dirty and
+* 			flushed with Xil_DCacheFlush, then made dirty again and flushed
+* 			line by line, until the line by line flush takes at least as long.
+*
+* @param	adr: Cache line aligned start address of a cacheable region of
+* 			maxlen bytes. Each line is rewritten with its own value, the
+* 			content is not changed.
+* @param	maxlen: Largest range size tried in bytes.
+*
+* @return	New threshold in bytes, 0 if no range up to maxlen was slower
+* 			than the full flush (full flushes are disabled then).
+*
+* @note		Call at startup, before DMA traffic starts and before the other
+* 			core writes the region. Both flushes are timed with IRQ/FIQ
+* 			masked, so that interrupts taken between the chunks of the range
+* 			flush are not counted. Flush counters are not changed by the
+* 			measurement.
+*
+****************************************************************************/
+u32 Xil_DCacheCalibrateFlushThreshold(INTPTR adr, u32 maxlen)
+{
+	XTime Start;
+	XTime End;
+	XTime FullTime;
+	XTime RangeTime;
+	Xil_DCacheFlushStats SavedStats = FlushStats;
+	u32 currmask = mfcpsr();
+	u32 len;
+	u32 Threshold = 0U;
+
+	FlushFullThreshold = 0U;
+
+	for (len = XIL_CACHE_CALIBRATE_MIN_SIZE; (len != 0U) && (len <= maxlen);
+			len <<= 1U) {
+		mtcpsr(currmask | IRQ_FIQ_MASK);
+
+		/* Same dirty data for both, the full flush writes back the range too */
+		Xil_DCacheDirtyRange(adr, len);
+		XTime_GetTime(&Start);
+		Xil_DCacheFlush();
+		XTime_GetTime(&End);
+		FullTime = End - Start;
+
+		Xil_DCacheDirtyRange(adr, len);
+		XTime_GetTime(&Start);
+		Xil_DCacheFlushRange(adr, len);
+		XTime_GetTime(&End);
+		RangeTime = End - Start;
+
+		mtcpsr(currmask);
+		if (RangeTime >= FullTime) {
+			Threshold = len;
+			break;
+		}
+	}
+
+	FlushStats = SavedStats;
+	FlushFullThreshold = Threshold;
+	return Threshold;
+}
+
+/****************************************************************************/
+/**
+* @brief	Get the number of Xil_DCacheFlushRange calls handled line by
+* 			line and as a full flush.
+*
+* @param	Stats: pointer to the structure the counters are copied to.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+void Xil_DCacheGetFlushStats(Xil_DCacheFlushStats *Stats)
+{
+	*Stats = FlushStats;
+}
+
+/****************************************************************************
+*
+* Merge Ranges[*Index] with the ranges following it that overlap it or
+* touch it. Zero length ranges are skipped.
+*
+* @param	Ranges: Array of ranges.
+* @param	Count: Number of ranges in the array.
+* @param	Index: In: first range to look at. Out: first range not merged.
+* @param	Start: Lowest byte address of the merged ranges.
+* @param	End: Address after the highest byte of the merged ranges.
+* @param	LineMerge: 1 to also merge ranges that only share a cache
+* 			line, 0 to merge only ranges that overlap or are adjacent
+* 			at byte granularity.
+*
+* @return	0 if no range with a non zero length was left, 1 otherwise.
+*
+* @note		Line granular merging is only safe for flush. For
+* 			invalidation the bytes between two ranges in a shared line
+* 			belong to someone else, the line has to be flushed as an edge
+* 			line instead of being invalidated.
+*
+****************************************************************************/
+static u32 Xil_DCacheMergeRanges(const Xil_DCacheRange *Ranges, u32 Count,
+				u32 *Index, u32 *Start, u32 *End, u32 LineMerge)
+{
+	const u32 cacheline = 32U;
+	u32 adr;
+	u32 end;
+
+	while ((*Index < Count) && (Ranges[*Index].Len == 0U)) {
+		*Index += 1U;
+	}
+	if (*Index >= Count) {
+		return 0U;
+	}
+
+	*Start = (u32)Ranges[*Index].Addr;
+	*End = *Start + Ranges[*Index].Len;
+	*Index += 1U;
+
+	while (*Index < Count) {
+		if (Ranges[*Index].Len != 0U) {
+			adr = (u32)Ranges[*Index].Addr;
+			end = adr + Ranges[*Index].Len;
+			if (LineMerge != 0U) {
+				if ((adr < (*Start & ~(cacheline - 1U))) ||
+					(adr > ((*End + cacheline - 1U) & ~(cacheline - 1U)))) {
+					break;
+				}
+			} else if ((adr < *Start) || (adr > *End)) {
+				break;
+			}
+			if (adr < *Start) {
+				*Start = adr;
+			}
+			if (end > *End) {
+				*End = end;
+			}
+		}
+		*Index += 1U;
+	}
+
+	return 1U;
+}
+
+/****************************************************************************/
+/**
+* @brief	Flush the Data cache for a list of address ranges, e.g. the
+* 			buffers and descriptors of one DMA transfer. Ranges that overlap
+* 			or are adjacent to the previous one in the list are merged, so
+* 			shared cache lines are flushed once. IRQ/FIQ are masked once per
+* 			XIL_CACHE_RANGE_CHUNK_SIZE bytes of lines rather than per range,
+* 			and one L2 cache sync and dsb are issued for the whole list.
+*
+* @param	Ranges: Array of address ranges.
+* @param	Count: Number of ranges in the array.
+*
+* @return	None.
+*
+* @note		Ranges are only merged with their neighbours in the list, pass
+* 			them in ascending address order. A list whose total length
+* 			reaches the flush threshold is handled by Xil_DCacheFlush.
+*
+****************************************************************************/
+void Xil_DCacheFlushRangeV(const Xil_DCacheRange *Ranges, u32 Count)
+{
+	const u32 cacheline = 32U;
+	u32 Index;
+	u32 Total = 0U;
+	u32 Start;
+	u32 End;
+	u32 chunkend;
+	u32 Budget = 0U;
+	u32 currmask;
+
+	for (Index = 0U; Index < Count; Index++) {
+		Total += Ranges[Index].Len;
+	}
+	if ((FlushFullThreshold != 0U) && (Total >= FlushFullThreshold)) {
+		FlushStats.FullFlushCount++;
+		Xil_DCacheFlush();
+		return;
+	}
+	FlushStats.RangeFlushCount++;
+
+	currmask = mfcpsr();
+	mtcpsr(currmask | IRQ_FIQ_MASK);
+
+	Index = 0U;
+	while (Xil_DCacheMergeRanges(Ranges, Count, &Index, &Start, &End, 1U) != 0U) {
+		Start &= ~(cacheline - 1U);
+		while (Start < End) {
+			chunkend = Start + (XIL_CACHE_RANGE_CHUNK_SIZE - Budget);
+			if ((chunkend > End) || (chunkend < Start)) {
+				chunkend = End;
+			}
+			Xil_DCacheFlushLines(Start, chunkend);
+			Budget += chunkend - Start;
+			Start = chunkend;
+
+			/* Let pending interrupts in between chunks */
+			if (Budget >= XIL_CACHE_RANGE_CHUNK_SIZE) {
+				mtcpsr(currmask);
+				mtcpsr(currmask | IRQ_FIQ_MASK);
+				Budget = 0U;
+			}
+		}
+	}
+
+#ifndef USE_AMP
+	Xil_L2CacheSync();
 #endif
+	mtcpsr(currmask);
+	dsb();
+}
+
+/****************************************************************************/
+/**
+* @brief	Invalidate the Data cache for a list of address ranges. Ranges
+* 			are merged only if they overlap or are adjacent, ranges that
+* 			just share a cache line are not. Partial cache lines at the
+* 			ends of each merged range are flushed first, see
+* 			Xil_DCacheInvalidateRange. IRQ/FIQ are masked once per
+* 			XIL_CACHE_RANGE_CHUNK_SIZE bytes of lines rather than per range.
+*
+* @param	Ranges: Array of address ranges.
+* @param	Count: Number of ranges in the array.
+*
+* @return	None.
+*
+* @note		Ranges are only merged with their neighbours in the list, pass
+* 			them in ascending address order.
+*
+****************************************************************************/
+void Xil_DCacheInvalidateRangeV(const Xil_DCacheRange *Ranges, u32 Count)
+{
+	const u32 cacheline = 32U;
+	u32 Index = 0U;
+	u32 Start;
+	u32 End;
+	u32 chunkend;
+	u32 Budget = 0U;
+	u32 currmask;
+
+	currmask = mfcpsr();
+	mtcpsr(currmask | IRQ_FIQ_MASK);
+
+	/* Select L1 Data cache in CSSR */
+	mtcp(XREG_CP15_CACHE_SIZE_SEL, 0U);
+
+	while (Xil_DCacheMergeRanges(Ranges, Count, &Index, &Start, &End, 0U) != 0U) {
+		if ((Start & (cacheline - 1U)) != 0U) {
+			Start &= ~(cacheline - 1U);
+			Xil_DCacheFlushEdgeLine(Start);
+			Start += cacheline;
+		}
+		if ((End & (cacheline - 1U)) != 0U) {
+			End &= ~(cacheline - 1U);
+			if (End >= Start) {
+				Xil_DCacheFlushEdgeLine(End);
+			}
+		}
 #ifndef USE_AMP
-			/* Flush L2 cache line */
-			*L2CCOffset = LocalAddr;
-			Xil_L2CacheSync();
+		Xil_L2CacheSync();
 #endif
-			LocalAddr += cacheline;
+
+		while (Start < End) {
+			chunkend = Start + (XIL_CACHE_RANGE_CHUNK_SIZE - Budget);
+			if ((chunkend > End) || (chunkend < Start)) {
+				chunkend = End;
+			}
+			Xil_DCacheInvalidateLines(Start, chunkend);
+			Budget += chunkend - Start;
+			Start = chunkend;
+
+			/* Let pending interrupts in between chunks */
+			if (Budget >= XIL_CACHE_RANGE_CHUNK_SIZE) {
+				mtcpsr(currmask);
+				mtcpsr(currmask | IRQ_FIQ_MASK);
+				Budget = 0U;
+			}
 		}
 	}
-	dsb();
+
 	mtcpsr(currmask);
+	dsb();
 }
 /****************************************************************************/
 /**
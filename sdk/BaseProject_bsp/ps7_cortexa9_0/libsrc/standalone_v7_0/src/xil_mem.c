@@ -29,8 +29,12 @@
 /**
 * @file xil_mem.c
 *
-* This file contains xil mem copy function to use in case of word aligned
-* data copies.
+* This file contains xil mem copy and fill functions. Destination is aligned
+* first, so that the bulk of the buffer is moved with aligned stores whatever
+* the source alignment is. When the compiler targets NEON (-mfpu=neon, which
+* defines __ARM_NEON__) with the hard float ABI, buffers of
+* XIL_MEM_NEON_MIN_SIZE bytes and above are moved in 64 byte blocks with
+* VLD1/VST1 and PLD prefetch, otherwise a 32 bit scalar loop is used.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -38,6 +42,11 @@
 * Ver   Who      Date     Changes
 * ----- -------- -------- -----------------------------------------------
 * 6.1   nsk      11/07/16 First release.
+* 7.0   bk       10/17/26 Aligned destination head/tail handling, unaligned
+*                         source word loads, NEON block kernels and
+*                         Xil_MemSet.
+* 7.0   bk       10/17/26 NEON kernels only with the hard float ABI, the
+*                         BSP is built with -mfpu=neon.
 *
 * </pre>
 *
@@ -46,8 +55,113 @@
 /***************************** Include Files ********************************/
 
 #include "xil_types.h"
+#include "xil_mem.h"
+#include "bspconfig.h"
+
+/************************** Constant Definitions ****************************/
+
+/*
+ * The NEON kernels use d0-d7. IRQ and FIQ entry in asm_vectors.S save them
+ * only if FPU_HARD_FLOAT_ABI_ENABLED, with softfp an interrupt handler that
+ * copies would corrupt an interrupted copy.
+ */
+#if defined(__ARM_NEON__) && !defined(__aarch64__) && FPU_HARD_FLOAT_ABI_ENABLED
+#define XIL_MEM_NEON	1
+#else
+#define XIL_MEM_NEON	0
+#endif
+
+/*
+ * Smaller buffers are moved by the scalar loop, the NEON setup costs more
+ * than it saves on them.
+ */
+#define XIL_MEM_NEON_MIN_SIZE	128U
+#define XIL_MEM_NEON_BLOCK	64U
+#define XIL_MEM_NEON_ALIGN	8U
+/*
+ * PLD distance, four 32 byte cache lines ahead of the current load.
+ */
+#define XIL_MEM_PLD_DISTANCE	"#128"
+
+/**************************** Type Definitions ******************************/
+
+/*
+ * Word access to a source of any alignment. ARMv7 handles unaligned LDR to
+ * normal memory, the packed attribute lets the compiler emit it.
+ */
+typedef struct {
+	u32 Word;
+} __attribute__((packed)) XilMemUnalignedWord;
+
+/************************** Function Prototypes *****************************/
+
+#if XIL_MEM_NEON
+static void Xil_MemCpyNeon(u8 *d, const u8 *s, u32 Blocks);
+static void Xil_MemSetNeon(u8 *d, u8 val, u32 Blocks);
+#endif
 
 /***************** Inline Functions Definitions ********************/
+
+#if XIL_MEM_NEON
+/*****************************************************************************/
+/**
+* @brief       Copies Blocks * 64 bytes. d must be 8 byte aligned, s can have
+*              any alignment. Only d0-d7 are used, IRQ and FIQ entry save
+*              them in hard float builds. The fast FIQ vector
+*              (XIL_FIQ_FAST_VECTOR) does not, do not copy from its handler.
+*
+* @param       d: 8 byte aligned destination
+*
+* @param       s: source
+*
+* @param       Blocks: number of 64 byte blocks, must not be 0
+*
+*****************************************************************************/
+static void Xil_MemCpyNeon(u8 *d, const u8 *s, u32 Blocks)
+{
+	__asm__ __volatile__(
+		"1:\n"
+		"pld	[%[s], " XIL_MEM_PLD_DISTANCE "]\n"
+		"vld1.8	{d0-d3}, [%[s]]!\n"
+		"vld1.8	{d4-d7}, [%[s]]!\n"
+		"subs	%[n], %[n], #1\n"
+		"vst1.64	{d0-d3}, [%[d], :64]!\n"
+		"vst1.64	{d4-d7}, [%[d], :64]!\n"
+		"bne	1b\n"
+		: [d] "+r" (d), [s] "+r" (s), [n] "+r" (Blocks)
+		:
+		: "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7", "cc", "memory");
+}
+
+/*****************************************************************************/
+/**
+* @brief       Fills Blocks * 64 bytes with val. d must be 8 byte aligned.
+*
+* @param       d: 8 byte aligned destination
+*
+* @param       val: fill byte
+*
+* @param       Blocks: number of 64 byte blocks, must not be 0
+*
+*****************************************************************************/
+static void Xil_MemSetNeon(u8 *d, u8 val, u32 Blocks)
+{
+	u32 Value = val;
+
+	__asm__ __volatile__(
+		"vdup.8	q0, %[v]\n"
+		"vmov	q1, q0\n"
+		"1:\n"
+		"subs	%[n], %[n], #1\n"
+		"vst1.64	{d0-d3}, [%[d], :64]!\n"
+		"vst1.64	{d0-d3}, [%[d], :64]!\n"
+		"bne	1b\n"
+		: [d] "+r" (d), [n] "+r" (Blocks)
+		: [v] "r" (Value)
+		: "d0", "d1", "d2", "d3", "cc", "memory");
+}
+#endif
+
 /*****************************************************************************/
 /**
 * @brief       This  function copies memory from once location to other.
@@ -58,24 +172,77 @@
 *
 * @param       cnt: 32 bit length of bytes to be copied
 *
+* @note        Source and destination must not overlap. The source can have
+*              any alignment relative to the destination, it is not copied
+*              bytewise in that case.
+*
 *****************************************************************************/
 void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 {
-	char *d = (char*)(void *)dst;
-	const char *s = src;
-
-	while (cnt >= sizeof (int)) {
-		*(int*)d = *(int*)s;
-		d += sizeof (int);
-		s += sizeof (int);
-		cnt -= sizeof (int);
+	u8 *d = (u8 *)dst;
+	const u8 *s = (const u8 *)src;
+	u32 Head;
+
+#if XIL_MEM_NEON
+	if (cnt >= XIL_MEM_NEON_MIN_SIZE) {
+		Head = (XIL_MEM_NEON_ALIGN - ((UINTPTR)d & (XIL_MEM_NEON_ALIGN - 1U))) &
+			(XIL_MEM_NEON_ALIGN - 1U);
+		cnt -= Head;
+		while (Head > 0U) {
+			*d = *s;
+			d += 1U;
+			s += 1U;
+			Head -= 1U;
+		}
+		Xil_MemCpyNeon(d, s, cnt / XIL_MEM_NEON_BLOCK);
+		d += cnt & ~(XIL_MEM_NEON_BLOCK - 1U);
+		s += cnt & ~(XIL_MEM_NEON_BLOCK - 1U);
+		cnt &= XIL_MEM_NEON_BLOCK - 1U;
 	}
-	while (cnt >= sizeof (u16)) {
-		*(u16*)d = *(u16*)s;
-		d += sizeof (u16);
-		s += sizeof (u16);
-		cnt -= sizeof (u16);
+#endif
+
+	/*
+	 * Align the destination, then move words. The source is read with
+	 * aligned loads when it ends up aligned as well.
+	 */
+	if (cnt >= sizeof (u32)) {
+		Head = (sizeof (u32) - ((UINTPTR)d & (sizeof (u32) - 1U))) &
+			(sizeof (u32) - 1U);
+		cnt -= Head;
+		while (Head > 0U) {
+			*d = *s;
+			d += 1U;
+			s += 1U;
+			Head -= 1U;
+		}
+
+		if (((UINTPTR)s & (sizeof (u32) - 1U)) == 0U) {
+			while (cnt >= (4U * sizeof (u32))) {
+				((u32 *)(void *)d)[0] = ((const u32 *)(const void *)s)[0];
+				((u32 *)(void *)d)[1] = ((const u32 *)(const void *)s)[1];
+				((u32 *)(void *)d)[2] = ((const u32 *)(const void *)s)[2];
+				((u32 *)(void *)d)[3] = ((const u32 *)(const void *)s)[3];
+				d += 4U * sizeof (u32);
+				s += 4U * sizeof (u32);
+				cnt -= 4U * sizeof (u32);
+			}
+			while (cnt >= sizeof (u32)) {
+				*(u32 *)(void *)d = *(const u32 *)(const void *)s;
+				d += sizeof (u32);
+				s += sizeof (u32);
+				cnt -= sizeof (u32);
+			}
+		} else {
+			while (cnt >= sizeof (u32)) {
+				*(u32 *)(void *)d =
+					((const XilMemUnalignedWord *)(const void *)s)->Word;
+				d += sizeof (u32);
+				s += sizeof (u32);
+				cnt -= sizeof (u32);
+			}
+		}
 	}
+
 	while ((cnt) > 0U){
 		*d = *s;
 		d += 1U;
@@ -83,3 +250,69 @@ void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 		cnt -= 1U;
 	}
 }
+
+/*****************************************************************************/
+/**
+* @brief       This function fills memory with a byte value.
+*
+* @param       dst: pointer pointing to destination memory
+*
+* @param       val: byte value written to every location
+*
+* @param       cnt: 32 bit length of bytes to be filled
+*
+*****************************************************************************/
+void Xil_MemSet(void* dst, u8 val, u32 cnt)
+{
+	u8 *d = (u8 *)dst;
+	u32 Head;
+	u32 Word;
+
+#if XIL_MEM_NEON
+	if (cnt >= XIL_MEM_NEON_MIN_SIZE) {
+		Head = (XIL_MEM_NEON_ALIGN - ((UINTPTR)d & (XIL_MEM_NEON_ALIGN - 1U))) &
+			(XIL_MEM_NEON_ALIGN - 1U);
+		cnt -= Head;
+		while (Head > 0U) {
+			*d = val;
+			d += 1U;
+			Head -= 1U;
+		}
+		Xil_MemSetNeon(d, val, cnt / XIL_MEM_NEON_BLOCK);
+		d += cnt & ~(XIL_MEM_NEON_BLOCK - 1U);
+		cnt &= XIL_MEM_NEON_BLOCK - 1U;
+	}
+#endif
+
+	if (cnt >= sizeof (u32)) {
+		Head = (sizeof (u32) - ((UINTPTR)d & (sizeof (u32) - 1U))) &
+			(sizeof (u32) - 1U);
+		cnt -= Head;
+		while (Head > 0U) {
+			*d = val;
+			d += 1U;
+			Head -= 1U;
+		}
+
+		Word = (u32)val * 0x01010101U;
+		while (cnt >= (4U * sizeof (u32))) {
+			((u32 *)(void *)d)[0] = Word;
+			((u32 *)(void *)d)[1] = Word;
+			((u32 *)(void *)d)[2] = Word;
+			((u32 *)(void *)d)[3] = Word;
+			d += 4U * sizeof (u32);
+			cnt -= 4U * sizeof (u32);
+		}
+		while (cnt >= sizeof (u32)) {
+			*(u32 *)(void *)d = Word;
+			d += sizeof (u32);
+			cnt -= sizeof (u32);
+		}
+	}
+
+	while (cnt > 0U) {
+		*d = val;
+		d += 1U;
+		cnt -= 1U;
+	}
+}
@@ -41,6 +41,35 @@ void print( const char8 *ptr);
 extern void outbyte (char8 c);
 extern char8 inbyte(void);
 
+/*---------------------------------------------------*/
+/* Buffered stdout. When STDOUT_BUFFERED is set,     */
+/* outbyte queues characters in a RAM ring that is   */
+/* drained by the UART TX empty interrupt. Connect   */
+/* XStdout_InterruptHandler to the STDOUT UART       */
+/* interrupt and call XStdout_Flush before a reset   */
+/* or on a panic path.                               */
+/* The STDOUT UART then belongs to outbyte only: no  */
+/* other driver may take its interrupt or write its  */
+/* IER, IDR or ISR. Use the other UART for data.     */
+/*---------------------------------------------------*/
+#ifndef STDOUT_BUFFERED
+#define STDOUT_BUFFERED 0
+#endif
+
+#ifndef STDOUT_BUFFER_SIZE
+#define STDOUT_BUFFER_SIZE 1024U	/* power of 2 */
+#endif
+
+#define XSTDOUT_POLICY_DROP	0U	/* discard characters when full */
+#define XSTDOUT_POLICY_BLOCK	1U	/* poll the UART until there is room */
+
+#if STDOUT_BUFFERED
+void XStdout_InterruptHandler(void *CallBackRef);
+void XStdout_Flush(void);
+void XStdout_SetPolicy(u32 Policy);
+u32 XStdout_GetDropCount(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
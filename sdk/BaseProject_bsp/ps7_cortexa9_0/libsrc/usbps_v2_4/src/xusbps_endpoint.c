@@ -50,6 +50,8 @@
  * 2.3   bss 01/19/16 Modified XUsbPs_EpQueueRequest function to fix CR#873972
  *            (moving of dTD Head/Tail Pointers)and CR#873974(invalidate
  *            Caches After Buffer Receive in Endpoint Buffer Handler...)
+ * 2.4   bk  10/17/26 Invalidate and flush the dTD rings of an endpoint with
+ *                    one Xil_DCache*RangeV call each instead of per dTD.
  * </pre>
  ******************************************************************************/
 
@@ -941,10 +943,27 @@ static int XUsbPs_dTDInit(XUsbPs_DeviceConfig *DevCfgPtr)
 	for (EpNum = 0; EpNum < DevCfgPtr->NumEndpoints; ++EpNum) {
 		int	Td;
 		int	NumdTD;
+		int	NumOutdTD;
+		int	NumIndTD;
+		Xil_DCacheRange	Rings[2];
 
 		XUsbPs_EpOut	*Out = &Ep[EpNum].Out;
 		XUsbPs_EpIn	*In  = &Ep[EpNum].In;
 
+		NumOutdTD = (XUSBPS_EP_TYPE_NONE != EpCfg[EpNum].Out.Type) ?
+				EpCfg[EpNum].Out.NumBufs : 0;
+		NumIndTD = (XUSBPS_EP_TYPE_NONE != EpCfg[EpNum].In.Type) ?
+				EpCfg[EpNum].In.NumBufs : 0;
+
+		/* Both rings are written below, move them through the cache in
+		 * one go rather than one dTD at a time.
+		 */
+		Rings[0].Addr = (INTPTR)Out->dTDs;
+		Rings[0].Len = NumOutdTD * sizeof(XUsbPs_dTD);
+		Rings[1].Addr = (INTPTR)In->dTDs;
+		Rings[1].Len = NumIndTD * sizeof(XUsbPs_dTD);
+		Xil_DCacheInvalidateRangeV(Rings, 2U);
+
 
 		/* OUT Descriptors
 		 * ===============
@@ -953,20 +972,13 @@ static int XUsbPs_dTDInit(XUsbPs_DeviceConfig *DevCfgPtr)
 		 * + Set the interrupt complete and the active bit
 		 * + Attach the buffer to the dTD
 		 */
-		if (XUSBPS_EP_TYPE_NONE != EpCfg[EpNum].Out.Type) {
-			NumdTD = EpCfg[EpNum].Out.NumBufs;
-		}
-		else {
-			NumdTD = 0;
-		}
+		NumdTD = NumOutdTD;
 
 		for (Td = 0; Td < NumdTD; ++Td) {
 			int	Status;
 
 			int NextTd = (Td + 1) % NumdTD;
 
-			XUsbPs_dTDInvalidateCache(&Out->dTDs[Td]);
-
 			/* Set NEXT link pointer. */
 			XUsbPs_WritedTD(&Out->dTDs[Td], XUSBPS_dTDNLP,
 					  &Out->dTDs[NextTd]);
@@ -983,7 +995,6 @@ static int XUsbPs_dTDInit(XUsbPs_DeviceConfig *DevCfgPtr)
 			 * to attach a buffer to this descriptor.
 			 */
 			if (NULL == Out->dTDBufs) {
-				XUsbPs_dTDFlushCache(&Out->dTDs[Td]);
 				continue;
 			}
 
@@ -993,10 +1004,9 @@ static int XUsbPs_dTDInit(XUsbPs_DeviceConfig *DevCfgPtr)
 						(Td * EpCfg[EpNum].Out.BufSize),
 					EpCfg[EpNum].Out.BufSize);
 			if (XST_SUCCESS != Status) {
+				Xil_DCacheFlushRangeV(Rings, 2U);
 				return XST_FAILURE;
 			}
-
-			XUsbPs_dTDFlushCache(&Out->dTDs[Td]);
 		}
 
 
@@ -1006,27 +1016,20 @@ static int XUsbPs_dTDInit(XUsbPs_DeviceConfig *DevCfgPtr)
 		 * + Set the next link pointer
 		 * + Set the Terminate bit to mark it available
 		 */
-		if (XUSBPS_EP_TYPE_NONE != EpCfg[EpNum].In.Type) {
-			NumdTD = EpCfg[EpNum].In.NumBufs;
-		}
-		else {
-			NumdTD = 0;
-		}
+		NumdTD = NumIndTD;
 
 		for (Td = 0; Td < NumdTD; ++Td) {
 			int NextTd = (Td + 1) % NumdTD;
 
-			XUsbPs_dTDInvalidateCache(&In->dTDs[Td]);
-
 			/* Set NEXT link pointer. */
 			XUsbPs_WritedTD(In->dTDs[Td], XUSBPS_dTDNLP,
 					  In->dTDs[NextTd]);
 
 			/* Set the IN descriptor's TERMINATE bits. */
 			XUsbPs_dTDSetTerminate(In->dTDs[Td]);
-
-			XUsbPs_dTDFlushCache(&In->dTDs[Td]);
 		}
+
+		Xil_DCacheFlushRangeV(Rings, 2U);
 	}
 
 	return XST_SUCCESS;
@@ -1360,6 +1363,7 @@ int EpNum, unsigned short NewDirection)
 	XUsbPs_EpConfig	*EpCfg;
 	int	Td;
 	int	NumdTD;
+	Xil_DCacheRange	Ring;
 
 
 	/* Setup pointers for simpler access.
@@ -1380,13 +1384,15 @@ int EpNum, unsigned short NewDirection)
 		 */
 		NumdTD = EpCfg[EpNum].Out.NumBufs;
 
+		Ring.Addr = (INTPTR)Out->dTDs;
+		Ring.Len = NumdTD * sizeof(XUsbPs_dTD);
+		Xil_DCacheInvalidateRangeV(&Ring, 1U);
+
 		for (Td = 0; Td < NumdTD; ++Td) {
 			int	Status;
 
 			int NextTd = (Td + 1) % NumdTD;
 
-			XUsbPs_dTDInvalidateCache(&Out->dTDs[Td]);
-
 			/* Set NEXT link pointer.
 			 */
 			XUsbPs_WritedTD(&Out->dTDs[Td], XUSBPS_dTDNLP,
@@ -1410,11 +1416,13 @@ int EpNum, unsigned short NewDirection)
 							(Td * EpCfg[EpNum].Out.BufSize),
 						EpCfg[EpNum].Out.BufSize);
 				if (Status != XST_SUCCESS) {
+					Xil_DCacheFlushRangeV(&Ring, 1U);
 					return XST_FAILURE;
 				}
 			}
-			XUsbPs_dTDFlushCache(&Out->dTDs[Td]);
 		}
+
+		Xil_DCacheFlushRangeV(&Ring, 1U);
 	} else if(NewDirection == XUSBPS_EP_DIRECTION_IN) {
 		XUsbPs_EpIn	*In  = &Ep[EpNum].In;
 
@@ -1426,11 +1434,13 @@ int EpNum, unsigned short NewDirection)
 		 */
 		NumdTD = EpCfg[EpNum].In.NumBufs;
 
+		Ring.Addr = (INTPTR)In->dTDs;
+		Ring.Len = NumdTD * sizeof(XUsbPs_dTD);
+		Xil_DCacheInvalidateRangeV(&Ring, 1U);
+
 		for (Td = 0; Td < NumdTD; ++Td) {
 			int NextTd = (Td + 1) % NumdTD;
 
-			XUsbPs_dTDInvalidateCache(&In->dTDs[Td]);
-
 			/* Set NEXT link pointer.
 			 */
 			XUsbPs_WritedTD(&In->dTDs[Td], XUSBPS_dTDNLP,
@@ -1439,9 +1449,9 @@ int EpNum, unsigned short NewDirection)
 			/* Set the IN descriptor's TERMINATE bits.
 			 */
 			XUsbPs_dTDSetTerminate(&In->dTDs[Td]);
-
-			XUsbPs_dTDFlushCache(&In->dTDs[Td]);
 		}
+
+		Xil_DCacheFlushRangeV(&Ring, 1U);
 	}
 
 	return XST_SUCCESS;
@@ -0,0 +1,161 @@
+/*
+ * Benchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * Cycle measurements of the drivers on target, all timed with PmuReadCycleCounter.
+ * Compiled in with BENCHMARK_ENABLE=1, main calls them after the drivers are initialized and prints the results.
+ */
+
+/**************Includes******************/
+#include "Benchmark.h"
+#include "Pmu.h"
+#include "xil_printf.h"
+#include "xil_types.h"
+#include "xparameters.h"
+
+#if BENCHMARK_ENABLE
+/**************Preprocessor******************/
+#define BENCHMARK_CPU_HZ XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ // PMU cycle counter rate
+
+/**************Definitions******************/
+static RUINT8 sau1UartTxData[BENCHMARK_UART_TX_SIZE];
+static volatile RUINT32 su4GICHandlerEntryCycle;
+static volatile RUINT32 su4GICHandlerCalls;
+
+/**************Functions******************/
+void BenchmarkResetResult(BenchmarkResultType *pResult)
+{
+	pResult->u4Count = 0U;
+	pResult->u4MinCycles = 0xFFFFFFFFU;
+	pResult->u4MaxCycles = 0U;
+	pResult->u4TotalCycles = 0U;
+}
+
+void BenchmarkRecord(BenchmarkResultType *pResult, RUINT32 u4Cycles)
+{
+	pResult->u4Count++;
+	pResult->u4TotalCycles += u4Cycles;
+	if(u4Cycles < pResult->u4MinCycles)
+	{
+		pResult->u4MinCycles = u4Cycles;
+	}
+	if(u4Cycles > pResult->u4MaxCycles)
+	{
+		pResult->u4MaxCycles = u4Cycles;
+	}
+}
+
+void BenchmarkPrintResult(const RCHAR *pcName, const BenchmarkResultType *pResult)
+{
+	RUINT32 u4Mean = 0U;
+
+	if(pResult->u4Count != 0U)
+	{
+		u4Mean = pResult->u4TotalCycles / pResult->u4Count;
+	}
+	xil_printf("%s : n %u, cycles min %u mean %u max %u\r\n", pcName, pResult->u4Count,
+			(pResult->u4Count != 0U) ? pResult->u4MinCycles : 0U, u4Mean, pResult->u4MaxCycles);
+}
+
+/*
+ * handler of BENCHMARK_GIC_SGI_ID, with GIC_STATIC_VECTOR_TABLE the table needs
+ * [BENCHMARK_GIC_SGI_ID] = { BenchmarkGICHandler, NULL }
+ */
+void BenchmarkGICHandler(void *pArgument)
+{
+	(void)pArgument;
+	su4GICHandlerEntryCycle = PmuReadCycleCounter();
+	su4GICHandlerCalls++;
+}
+
+/*
+ * IRQ dispatch latency : cycles from raising an SGI to this CPU until its handler is entered. covers GIC signalling,
+ * exception entry, ICCIAR read and the vector table lookup. build once with GIC_STATIC_VECTOR_TABLE=0 and once
+ * with 1, the difference of the mean is the cycles the static table saves per interrupt.
+ * to be called on CPU0 with the GIC started, not from interrupt context. the SGI keeps its default priority.
+ */
+ReturnType BenchmarkGICDispatch(GICInstanceType *pGICInstance, BenchmarkResultType *pResult)
+{
+	RUINT32 u4Index;
+	RUINT32 u4Calls;
+	RUINT32 u4StartCycle;
+
+	if((pGICInstance == NULL) || (pResult == NULL))
+	{
+		return XST_FAILURE;
+	}
+	// with a static table this only checks the entry is there
+	if(GICConnectInterruptHandler(pGICInstance, BENCHMARK_GIC_SGI_ID, BenchmarkGICHandler, NULL) != GIC_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
+
+	PmuEnableCycleCounter();
+	BenchmarkResetResult(pResult);
+	for(u4Index = 0U; u4Index < BENCHMARK_GIC_ITERATIONS; u4Index++)
+	{
+		u4Calls = su4GICHandlerCalls;
+		u4StartCycle = PmuReadCycleCounter();
+		(void)GICSendSoftwareInterrupt(BENCHMARK_GIC_SGI_ID, GIC_CPU0_MASK);
+		while(su4GICHandlerCalls == u4Calls)
+		{
+			// handler runs as soon as the SGI is signalled
+		}
+		BenchmarkRecord(pResult, su4GICHandlerEntryCycle - u4StartCycle);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*
+ * polled transmit throughput : BENCHMARK_UART_TX_SIZE bytes through UartSendData, timed from the first fifo write
+ * until the transmitter is idle, against the line rate of the programmed divisor. a burst fill keeps the line busy,
+ * so the achieved rate is the line rate minus the start up of the first character.
+ * the instance has to be initialized, its TX interrupt may be enabled but nothing else may send meanwhile.
+ */
+ReturnType BenchmarkUartTx(uartCfgType *pCfgInstance, BenchmarkUartType *pResult)
+{
+	uartBaudDivisorType Divisor;
+	RUINT32 u4Index;
+	RUINT32 u4StartCycle;
+
+	if((pResult == NULL) || (UartGetBaudRateInfo(pCfgInstance, &Divisor) != XST_SUCCESS))
+	{
+		return XST_FAILURE;
+	}
+	for(u4Index = 0U; u4Index < BENCHMARK_UART_TX_SIZE; u4Index++)
+	{
+		sau1UartTxData[u4Index] = (RUINT8)('a' + (u4Index % 26U));
+	}
+
+	PmuEnableCycleCounter();
+	// earlier output would be counted as this transfer
+	(void)UartTxWaitIdle(pCfgInstance);
+	u4StartCycle = PmuReadCycleCounter();
+	(void)UartSendData(sau1UartTxData, pCfgInstance, BENCHMARK_UART_TX_SIZE);
+	(void)UartTxWaitIdle(pCfgInstance);
+	pResult->u4Cycles = PmuReadCycleCounter() - u4StartCycle;
+
+	pResult->u4Bytes = BENCHMARK_UART_TX_SIZE;
+	pResult->u4BytesPerSecond = (RUINT32)(((u64)BENCHMARK_UART_TX_SIZE * BENCHMARK_CPU_HZ) / pResult->u4Cycles);
+	pResult->u4LineBytesPerSecond = Divisor.u4ActualBaudRate / BENCHMARK_UART_BITS_PER_CHAR;
+
+	return XST_SUCCESS;
+}
+
+void BenchmarkPrintUartTx(const RCHAR *pcName, const BenchmarkUartType *pResult)
+{
+	RUINT32 u4Permille = 0U;
+
+	if(pResult->u4LineBytesPerSecond != 0U)
+	{
+		u4Permille = (RUINT32)(((u64)pResult->u4BytesPerSecond * 1000U) / pResult->u4LineBytesPerSecond);
+	}
+	xil_printf("%s : %u bytes in %u cycles, %u bytes/s of %u line rate (%u.%u%%)\r\n", pcName, pResult->u4Bytes,
+			pResult->u4Cycles, pResult->u4BytesPerSecond, pResult->u4LineBytesPerSecond, u4Permille / 10U, u4Permille % 10U);
+}
+#endif
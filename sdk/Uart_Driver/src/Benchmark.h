@@ -0,0 +1,82 @@
+/*
+ * Benchmark.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_BENCHMARK_H_
+#define SRC_BENCHMARK_H_
+/**************Inclusions******************/
+#include "CommonTypes.h"
+#include "GIC.h"
+#include "Uart.h"
+/**************Macros******************/
+/*on target measurements timed with the PMU cycle counter, build with BENCHMARK_ENABLE=1 to compile them in*/
+#ifndef BENCHMARK_ENABLE
+#define BENCHMARK_ENABLE 0
+#endif
+#define BENCHMARK_GIC_SGI_ID 15U // SGI raised by BenchmarkGICDispatch, must not be used by the application
+#define BENCHMARK_GIC_ITERATIONS 1000U
+#define BENCHMARK_UART_TX_SIZE 4096U // bytes sent by BenchmarkUartTx, 44 ms at 921600 baud
+#define BENCHMARK_UART_BITS_PER_CHAR 10U // start + 8 data + stop, InitializeUart programs 8N1
+#define BENCHMARK_CACHE_MIN_SIZE (4U * 1024U)
+#define BENCHMARK_CACHE_SIZES 9U // 4 KB doubling up to 1 MB, twice the L2 cache
+#define BENCHMARK_CACHE_MAX_SIZE (BENCHMARK_CACHE_MIN_SIZE << (BENCHMARK_CACHE_SIZES - 1U))
+#define BENCHMARK_MEM_MIN_SIZE 16U
+#define BENCHMARK_MEM_SIZES 17U // 16 B doubling up to 1 MB
+#define BENCHMARK_MEM_MAX_SIZE (BENCHMARK_MEM_MIN_SIZE << (BENCHMARK_MEM_SIZES - 1U))
+#define BENCHMARK_MEM_ALIGNMENTS 3U // source / destination offsets timed for every size, see BenchmarkMem.c
+
+/**************Definitions******************/
+typedef struct {
+	RUINT32 u4Count; // samples
+	RUINT32 u4MinCycles;
+	RUINT32 u4MaxCycles;
+	RUINT32 u4TotalCycles; // sum of samples, mean is u4TotalCycles / u4Count
+} BenchmarkResultType;
+
+typedef struct {
+	RUINT32 u4Bytes;
+	RUINT32 u4Cycles; // first fifo write until the last stop bit left the line
+	RUINT32 u4BytesPerSecond; // achieved
+	RUINT32 u4LineBytesPerSecond; // programmed baud rate / BENCHMARK_UART_BITS_PER_CHAR
+} BenchmarkUartType;
+
+typedef struct {
+	RUINT32 u4Size; // bytes flushed
+	RUINT32 u4RangeCycles; // Xil_DCacheFlushRange line by line
+	RUINT32 u4IrqOffCycles; // longest IRQ/FIQ masked window of Xil_DCacheFlushRange
+	RUINT32 u4LegacyCycles; // per line L2 sync loop, IRQ/FIQ masked all along
+	RUINT32 u4FullCycles; // Xil_DCacheFlush with the same range dirty
+} BenchmarkCacheType;
+
+typedef struct {
+	RUINT32 u4MeasuredSize; // smallest size the range flush was not faster than the full flush at, 0 : none
+	RUINT32 u4CalibratedSize; // Xil_DCacheCalibrateFlushThreshold on the same buffer
+	RUINT32 u4RangeFlushCount; // Xil_DCacheFlushRange counters of one flush of each size at the calibrated threshold
+	RUINT32 u4FullFlushCount;
+} BenchmarkCrossoverType;
+
+typedef struct {
+	RUINT32 u4Size;
+	RUINT32 au4Cycles[BENCHMARK_MEM_ALIGNMENTS];
+} BenchmarkMemType;
+
+/**************Prototypes******************/
+void BenchmarkResetResult(BenchmarkResultType *pResult);
+void BenchmarkRecord(BenchmarkResultType *pResult, RUINT32 u4Cycles);
+void BenchmarkPrintResult(const RCHAR *pcName, const BenchmarkResultType *pResult);
+void BenchmarkGICHandler(void *pArgument);
+ReturnType BenchmarkGICDispatch(GICInstanceType *pGICInstance, BenchmarkResultType *pResult);
+ReturnType BenchmarkUartTx(uartCfgType *pCfgInstance, BenchmarkUartType *pResult);
+void BenchmarkPrintUartTx(const RCHAR *pcName, const BenchmarkUartType *pResult);
+void BenchmarkDCacheFlushRange(BenchmarkCacheType *pResults); // BENCHMARK_CACHE_SIZES entries, BenchmarkCache.c
+void BenchmarkPrintDCacheFlushRange(const BenchmarkCacheType *pResults);
+void BenchmarkDCacheCrossover(const BenchmarkCacheType *pResults, BenchmarkCrossoverType *pCrossover);
+void BenchmarkPrintDCacheCrossover(const BenchmarkCrossoverType *pCrossover);
+void BenchmarkMemCpy(BenchmarkMemType *pResults); // BENCHMARK_MEM_SIZES entries, BenchmarkMem.c
+void BenchmarkMemSet(BenchmarkMemType *pResults);
+void BenchmarkPrintMemCpy(const BenchmarkMemType *pResults);
+void BenchmarkPrintMemSet(const BenchmarkMemType *pResults);
+
+#endif /* SRC_BENCHMARK_H_ */
@@ -0,0 +1,172 @@
+/*
+ * BenchmarkCache.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * D-cache range maintenance of the BSP timed with the PMU cycle counter, target only - the host tests have no
+ * cache model. Every timed operation starts from the same state : the measured range is made dirty first,
+ * so each line costs an L1 write back and an L2 clean.
+ */
+
+/**************Includes******************/
+#include "Benchmark.h"
+#include "Pmu.h"
+#include "xil_cache.h"
+#include "xil_io.h"
+#include "xil_printf.h"
+#include "xl2cc.h"
+#include "xparameters.h"
+#include "xpseudo_asm.h"
+#include "xreg_cortexa9.h"
+
+#if BENCHMARK_ENABLE
+/**************Preprocessor******************/
+#define BENCHMARK_CACHE_LINE 32U
+#define BENCHMARK_IRQ_FIQ_MASK 0xC0U
+
+/**************Definitions******************/
+static RUINT8 sau1CacheBuffer[BENCHMARK_CACHE_MAX_SIZE] __attribute__((aligned(BENCHMARK_CACHE_LINE)));
+
+/**************Functions******************/
+/*rewrites the first word of each line with its own value, the line is allocated and dirty afterwards*/
+static void benchmarkDirtyRange(RUINT8 *pu1Data, RUINT32 u4Size)
+{
+	RUINT32 u4Offset;
+	volatile RUINT32 *pu4Word;
+
+	for(u4Offset = 0U; u4Offset < u4Size; u4Offset += BENCHMARK_CACHE_LINE)
+	{
+		pu4Word = (volatile RUINT32 *)&pu1Data[u4Offset];
+		*pu4Word = *pu4Word;
+	}
+	dsb();
+}
+
+/*
+ * Xil_DCacheFlushRange before range maintenance was chunked : IRQ/FIQ masked for the whole range and an L2 cache
+ * sync after every line
+ */
+static void benchmarkLegacyFlushRange(RUINT32 u4Addr, RUINT32 u4Size)
+{
+	RUINT32 u4End = u4Addr + u4Size;
+	RUINT32 u4Mask = mfcpsr();
+	volatile RUINT32 *pu4L2CleanInv = (volatile RUINT32 *)(XPS_L2CC_BASEADDR + XPS_L2CC_CACHE_INV_CLN_PA_OFFSET);
+
+	mtcpsr(u4Mask | BENCHMARK_IRQ_FIQ_MASK);
+	for(u4Addr &= ~(BENCHMARK_CACHE_LINE - 1U); u4Addr < u4End; u4Addr += BENCHMARK_CACHE_LINE)
+	{
+		asm_cp15_clean_inval_dc_line_mva_poc(u4Addr);
+		*pu4L2CleanInv = u4Addr;
+		Xil_Out32(XPS_L2CC_BASEADDR + XPS_L2CC_CACHE_SYNC_OFFSET, 0x0U);
+	}
+	dsb();
+	mtcpsr(u4Mask);
+}
+
+/*
+ * Xil_DCacheFlushRange line by line against the per line L2 sync loop it replaced and against Xil_DCacheFlush, sizes from
+ * BENCHMARK_CACHE_MIN_SIZE doubling up to BENCHMARK_CACHE_MAX_SIZE. IRQ-off time of the current code is one chunk
+ * of XIL_CACHE_RANGE_CHUNK_SIZE bytes, the old loop masked IRQ/FIQ for the whole range.
+ * full flush threshold is lifted while it runs so every size is walked line by line.
+ */
+void BenchmarkDCacheFlushRange(BenchmarkCacheType *pResults)
+{
+	RUINT32 u4Index;
+	RUINT32 u4Size;
+	RUINT32 u4ChunkSize;
+	RUINT32 u4StartCycle;
+	RUINT32 u4Threshold = Xil_DCacheGetFlushThreshold();
+	const RUINT32 u4Addr = (RUINT32)(UINTPTR)sau1CacheBuffer;
+
+	PmuEnableCycleCounter();
+	Xil_DCacheSetFlushThreshold(0U);
+
+	for(u4Index = 0U, u4Size = BENCHMARK_CACHE_MIN_SIZE; u4Index < BENCHMARK_CACHE_SIZES; u4Index++, u4Size <<= 1U)
+	{
+		pResults[u4Index].u4Size = u4Size;
+
+		benchmarkDirtyRange(sau1CacheBuffer, u4Size);
+		u4StartCycle = PmuReadCycleCounter();
+		Xil_DCacheFlushRange((INTPTR)u4Addr, u4Size);
+		pResults[u4Index].u4RangeCycles = PmuReadCycleCounter() - u4StartCycle;
+
+		// longest masked window : one chunk, the final L2 sync and DSB run with IRQs enabled
+		u4ChunkSize = (u4Size < XIL_CACHE_RANGE_CHUNK_SIZE) ? u4Size : XIL_CACHE_RANGE_CHUNK_SIZE;
+		benchmarkDirtyRange(sau1CacheBuffer, u4ChunkSize);
+		u4StartCycle = PmuReadCycleCounter();
+		Xil_DCacheFlushRange((INTPTR)u4Addr, u4ChunkSize);
+		pResults[u4Index].u4IrqOffCycles = PmuReadCycleCounter() - u4StartCycle;
+
+		benchmarkDirtyRange(sau1CacheBuffer, u4Size);
+		u4StartCycle = PmuReadCycleCounter();
+		benchmarkLegacyFlushRange(u4Addr, u4Size);
+		pResults[u4Index].u4LegacyCycles = PmuReadCycleCounter() - u4StartCycle;
+
+		benchmarkDirtyRange(sau1CacheBuffer, u4Size);
+		u4StartCycle = PmuReadCycleCounter();
+		Xil_DCacheFlush();
+		pResults[u4Index].u4FullCycles = PmuReadCycleCounter() - u4StartCycle;
+	}
+
+	Xil_DCacheSetFlushThreshold(u4Threshold);
+}
+
+void BenchmarkPrintDCacheFlushRange(const BenchmarkCacheType *pResults)
+{
+	RUINT32 u4Index;
+
+	xil_printf("dcache flush range, cycles : size, range, irq off, old range (irq off), full flush\r\n");
+	for(u4Index = 0U; u4Index < BENCHMARK_CACHE_SIZES; u4Index++)
+	{
+		xil_printf("  %u : %u, %u, %u, %u\r\n", pResults[u4Index].u4Size, pResults[u4Index].u4RangeCycles,
+				pResults[u4Index].u4IrqOffCycles, pResults[u4Index].u4LegacyCycles, pResults[u4Index].u4FullCycles);
+	}
+}
+
+/*
+ * crossover of range and full flush from BenchmarkDCacheFlushRange results next to the one
+ * Xil_DCacheCalibrateFlushThreshold finds on the same buffer. then one range of each size is flushed at the
+ * calibrated threshold, the flush counters show which way each went. threshold in use before is restored.
+ */
+void BenchmarkDCacheCrossover(const BenchmarkCacheType *pResults, BenchmarkCrossoverType *pCrossover)
+{
+	RUINT32 u4Index;
+	RUINT32 u4Threshold = Xil_DCacheGetFlushThreshold();
+	Xil_DCacheFlushStats StatsBefore;
+	Xil_DCacheFlushStats StatsAfter;
+
+	pCrossover->u4MeasuredSize = 0U;
+	for(u4Index = 0U; u4Index < BENCHMARK_CACHE_SIZES; u4Index++)
+	{
+		if(pResults[u4Index].u4RangeCycles >= pResults[u4Index].u4FullCycles)
+		{
+			pCrossover->u4MeasuredSize = pResults[u4Index].u4Size;
+			break;
+		}
+	}
+
+	pCrossover->u4CalibratedSize = Xil_DCacheCalibrateFlushThreshold((INTPTR)(UINTPTR)sau1CacheBuffer, BENCHMARK_CACHE_MAX_SIZE);
+
+	Xil_DCacheGetFlushStats(&StatsBefore);
+	for(u4Index = 0U; u4Index < BENCHMARK_CACHE_SIZES; u4Index++)
+	{
+		benchmarkDirtyRange(sau1CacheBuffer, pResults[u4Index].u4Size);
+		Xil_DCacheFlushRange((INTPTR)(UINTPTR)sau1CacheBuffer, pResults[u4Index].u4Size);
+	}
+	Xil_DCacheGetFlushStats(&StatsAfter);
+	pCrossover->u4RangeFlushCount = StatsAfter.RangeFlushCount - StatsBefore.RangeFlushCount;
+	pCrossover->u4FullFlushCount = StatsAfter.FullFlushCount - StatsBefore.FullFlushCount;
+
+	Xil_DCacheSetFlushThreshold(u4Threshold);
+}
+
+void BenchmarkPrintDCacheCrossover(const BenchmarkCrossoverType *pCrossover)
+{
+	xil_printf("dcache flush crossover : measured %u, calibrated %u bytes, range flushes %u, full flushes %u\r\n",
+			pCrossover->u4MeasuredSize, pCrossover->u4CalibratedSize, pCrossover->u4RangeFlushCount,
+			pCrossover->u4FullFlushCount);
+}
+#endif
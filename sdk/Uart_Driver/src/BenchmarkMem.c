@@ -0,0 +1,158 @@
+/*
+ * BenchmarkMem.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * Xil_MemCpy / Xil_MemSet of the BSP timed with the PMU cycle counter, target only. Sizes from
+ * BENCHMARK_MEM_MIN_SIZE doubling up to BENCHMARK_MEM_MAX_SIZE, each in every alignment case. a call is made
+ * once untimed so the timed one finds the buffers in cache as far as they fit, sizes above the L2 cache stream
+ * from DDR either way. cost of reading the cycle counter is taken out of every sample.
+ */
+
+/**************Includes******************/
+#include "Benchmark.h"
+#include "Pmu.h"
+#include "xil_mem.h"
+#include "xil_printf.h"
+
+#if BENCHMARK_ENABLE
+/**************Preprocessor******************/
+#define BENCHMARK_MEM_BUFFER_ALIGN 64U
+#define BENCHMARK_MEM_BUFFER_SIZE (BENCHMARK_MEM_MAX_SIZE + BENCHMARK_MEM_BUFFER_ALIGN)
+#define BENCHMARK_MEM_FILL 0x5AU
+
+/**************Definitions******************/
+typedef struct {
+	RUINT32 u4DstOffset; // from a BENCHMARK_MEM_BUFFER_ALIGN aligned address
+	RUINT32 u4SrcOffset; // unused by Xil_MemSet
+	const RCHAR *pcName;
+} benchmarkMemAlignmentType;
+
+/*aligned, word copy with unaligned source loads, destination head before the aligned part*/
+static const benchmarkMemAlignmentType saCopyAlignments[BENCHMARK_MEM_ALIGNMENTS] = {
+	{ 0U, 0U, "aligned" },
+	{ 0U, 1U, "src +1" },
+	{ 1U, 0U, "dst +1" },
+};
+
+/*aligned, byte head, word aligned but off the 8 byte alignment of the NEON kernel*/
+static const benchmarkMemAlignmentType saSetAlignments[BENCHMARK_MEM_ALIGNMENTS] = {
+	{ 0U, 0U, "aligned" },
+	{ 1U, 0U, "dst +1" },
+	{ 4U, 0U, "dst +4" },
+};
+
+static RUINT8 sau1MemSrc[BENCHMARK_MEM_BUFFER_SIZE] __attribute__((aligned(BENCHMARK_MEM_BUFFER_ALIGN)));
+static RUINT8 sau1MemDst[BENCHMARK_MEM_BUFFER_SIZE] __attribute__((aligned(BENCHMARK_MEM_BUFFER_ALIGN)));
+
+/**************Functions******************/
+/*cycles of two back to back cycle counter reads*/
+static RUINT32 benchmarkMemOverhead(void)
+{
+	RUINT32 u4StartCycle = PmuReadCycleCounter();
+
+	return PmuReadCycleCounter() - u4StartCycle;
+}
+
+static RUINT32 benchmarkMemSample(RUINT32 u4Cycles, RUINT32 u4Overhead)
+{
+	return (u4Cycles > u4Overhead) ? (u4Cycles - u4Overhead) : 1U;
+}
+
+static void benchmarkPrintMem(const RCHAR *pcName, const benchmarkMemAlignmentType *pAlignments,
+		const BenchmarkMemType *pResults)
+{
+	RUINT32 u4Index;
+	RUINT32 u4Case;
+	RUINT32 u4Milli;
+
+	xil_printf("%s, bytes/cycle : size", pcName);
+	for(u4Case = 0U; u4Case < BENCHMARK_MEM_ALIGNMENTS; u4Case++)
+	{
+		xil_printf(", %s", pAlignments[u4Case].pcName);
+	}
+	xil_printf("\r\n");
+
+	for(u4Index = 0U; u4Index < BENCHMARK_MEM_SIZES; u4Index++)
+	{
+		xil_printf("  %u :", pResults[u4Index].u4Size);
+		for(u4Case = 0U; u4Case < BENCHMARK_MEM_ALIGNMENTS; u4Case++)
+		{
+			// size is at most 1 MB, times 1000 still fits 32 bits
+			u4Milli = (pResults[u4Index].u4Size * 1000U) / pResults[u4Index].au4Cycles[u4Case];
+			xil_printf(" %u.%03u", u4Milli / 1000U, u4Milli % 1000U);
+		}
+		xil_printf("\r\n");
+	}
+}
+
+void BenchmarkMemCpy(BenchmarkMemType *pResults)
+{
+	RUINT32 u4Index;
+	RUINT32 u4Case;
+	RUINT32 u4Size;
+	RUINT32 u4StartCycle;
+	RUINT32 u4Overhead;
+	RUINT8 *pu1Dst;
+	const RUINT8 *pu1Src;
+
+	PmuEnableCycleCounter();
+	u4Overhead = benchmarkMemOverhead();
+	Xil_MemSet(sau1MemSrc, BENCHMARK_MEM_FILL, BENCHMARK_MEM_BUFFER_SIZE);
+
+	for(u4Index = 0U, u4Size = BENCHMARK_MEM_MIN_SIZE; u4Index < BENCHMARK_MEM_SIZES; u4Index++, u4Size <<= 1U)
+	{
+		pResults[u4Index].u4Size = u4Size;
+		for(u4Case = 0U; u4Case < BENCHMARK_MEM_ALIGNMENTS; u4Case++)
+		{
+			pu1Dst = &sau1MemDst[saCopyAlignments[u4Case].u4DstOffset];
+			pu1Src = &sau1MemSrc[saCopyAlignments[u4Case].u4SrcOffset];
+
+			Xil_MemCpy(pu1Dst, pu1Src, u4Size);
+			u4StartCycle = PmuReadCycleCounter();
+			Xil_MemCpy(pu1Dst, pu1Src, u4Size);
+			pResults[u4Index].au4Cycles[u4Case] = benchmarkMemSample(PmuReadCycleCounter() - u4StartCycle, u4Overhead);
+		}
+	}
+}
+
+void BenchmarkMemSet(BenchmarkMemType *pResults)
+{
+	RUINT32 u4Index;
+	RUINT32 u4Case;
+	RUINT32 u4Size;
+	RUINT32 u4StartCycle;
+	RUINT32 u4Overhead;
+	RUINT8 *pu1Dst;
+
+	PmuEnableCycleCounter();
+	u4Overhead = benchmarkMemOverhead();
+
+	for(u4Index = 0U, u4Size = BENCHMARK_MEM_MIN_SIZE; u4Index < BENCHMARK_MEM_SIZES; u4Index++, u4Size <<= 1U)
+	{
+		pResults[u4Index].u4Size = u4Size;
+		for(u4Case = 0U; u4Case < BENCHMARK_MEM_ALIGNMENTS; u4Case++)
+		{
+			pu1Dst = &sau1MemDst[saSetAlignments[u4Case].u4DstOffset];
+
+			Xil_MemSet(pu1Dst, BENCHMARK_MEM_FILL, u4Size);
+			u4StartCycle = PmuReadCycleCounter();
+			Xil_MemSet(pu1Dst, BENCHMARK_MEM_FILL, u4Size);
+			pResults[u4Index].au4Cycles[u4Case] = benchmarkMemSample(PmuReadCycleCounter() - u4StartCycle, u4Overhead);
+		}
+	}
+}
+
+void BenchmarkPrintMemCpy(const BenchmarkMemType *pResults)
+{
+	benchmarkPrintMem("Xil_MemCpy", saCopyAlignments, pResults);
+}
+
+void BenchmarkPrintMemSet(const BenchmarkMemType *pResults)
+{
+	benchmarkPrintMem("Xil_MemSet", saSetAlignments, pResults);
+}
+#endif
@@ -8,15 +8,23 @@
 
 #include "GIC.h"
 #include "xil_exception.h"
+#include "xpseudo_asm.h"
+#include "xparameters.h"
+#include "Pmu.h"
+#include <string.h>
 
 /***********definitions**************/
 #define RegisterSize 4
 
 //macro definitions
-#define ICDFROffset(x) (ICDICFR_BASE_OFFSET + RegisterSize*x)
-#define ICDIPROffset(x) (ICDIPR_BASE_OFFSET + RegisterSize*x)
-#define ICDIPTROffset(x) (ICDIPTR_BASE_OFFSET + RegisterSize*x)
-#define ICDISEROffset(x) (ICDISER_BASE_OFFSET + RegisterSize*x)
+#define ICDFROffset(x) (ICDICFR_BASE_OFFSET + RegisterSize*(x))
+#define ICDIPROffset(x) (ICDIPR_BASE_OFFSET + RegisterSize*(x))
+#define ICDIPTROffset(x) (ICDIPTR_BASE_OFFSET + RegisterSize*(x))
+#define ICDISEROffset(x) (ICDISER_BASE_OFFSET + RegisterSize*(x))
+#define ICDICEROffset(x) (ICDICER_BASE_OFFSET + RegisterSize*(x))
+#define ICDICPROffset(x) (ICDICPR_BASE_OFFSET + RegisterSize*(x))
+#define ICDISPROffset(x) (ICDISPR_BASE_OFFSET + RegisterSize*(x))
+#define ICDISROffset(x) (ICDISR_BASE_OFFSET + RegisterSize*(x))
 #define rightShift(x) (0x1 << x)
 #define leftShift(x) (0x1 >> x)
 
@@ -35,12 +43,66 @@
 #define ICDIPR_BASE_OFFSET 0x00001400 		// Distributor interrupt priority register base address[0:23]
 #define ICDIPTR_BASE_OFFSET 0x00001800 		// Distributor interrupt target CPU core register base address[0:23]
 #define ICDISER_BASE_OFFSET 0x00001100 		// Distributor interrupt enable register base address [0:2]
+#define ICDICER_BASE_OFFSET 0x00001180 		// Distributor interrupt clear enable register base address [0:2]
+#define ICDICPR_BASE_OFFSET 0x00001280 		// Distributor interrupt clear pending register base address [0:2]
+#define ICDISPR_BASE_OFFSET 0x00001200 		// Distributor interrupt set pending register base address [0:2], reads pending state
+//private timer, clocked at CPU clock / 2
+#define PTLR_OFFSET 0x00000600 				// Private Timer Load Register
+#define PTCTLR_OFFSET 0x00000608 			// Private Timer Control Register
+#define PTISR_OFFSET 0x0000060C 			// Private Timer Interrupt Status Register, write 1 to clear
+#define PTCTLR_ENABLE 0
+#define PTCTLR_AUTO_RELOAD 1
+#define PTCTLR_IRQ_ENABLE 2
+#define PRIVATE_TIMER_TICKS_PER_US ((XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ / 2U) / 1000000U)
+#define ICDSGIR_OFFSET 0x00001F00 			// Software generated interrupt register
+#define ICDISR_BASE_OFFSET 0x00001080 		// Distributor interrupt security registers [0:2] - 0 : group 0 (secure), 1 : group 1
+#define ICDISR_COUNT 3U
+#define ICDSGIR_SATT 15 					// send SGI only if it is group 1 (non secure) on the target
+
+#define ICDSGIR_TARGET_LIST_SHIFT 16 		// CPUTargetList field, TargetListFilter (bits [25:24]) is kept 0 - use the list
+
+#define GIC_SPURIOUS_INTERRUPT_ID 1023U // ICCIAR value when nothing is pending for this CPU
+
+/*handler table entry of an ID - run time table of the instance or the application's const table*/
+#if GIC_STATIC_VECTOR_TABLE
+#define GIC_VECTOR(GICInstacePtr, ID) (GICStaticVectorTable[(ID)])
+#else
+#define GIC_VECTOR(GICInstacePtr, ID) ((GICInstacePtr)->InterruptHandlerVector[(ID)])
+#endif
+
+#define GIC_NO_FIQ_ID 0xFFFFFFFFU // no interrupt is routed to FIQ
+#define GIC_FIRST_SPI_ID 32U // IDs below are SGIs and PPIs, their trigger type is fixed
+#define GIC_PRIORITY_MASK_VALUE 0xF0U // ICCPMR value, only priorities below it are signalled
 
 #define ICCICR_SBPR 4
 #define ICCICR_FIQEn 3
 #define ICCICR_AckCtl 2
 #define ICCICR_EnableNS 1
 #define ICCICR_EnableS 0
+#define ICDDCR_EnableNS 1 // forward group 1 interrupts
+#define ICDDCR_EnableS 0 // forward group 0 interrupts
+
+/*
+ * deferred work (bottom half) queue. interrupt handlers post work items, items are run by
+ * GICInterruptHandler after end of interrupt is signalled, with IRQs enabled again.
+ */
+typedef struct {
+	InterruptHandlerType Items[GIC_DEFERRED_QUEUE_SIZE];
+	volatile RUINT32 u4Head; // written by GICPostDeferredWork with IRQs masked
+	volatile RUINT32 u4Tail; // written by queue runner only
+	volatile RUINT32 u4Running; // set while an interrupt level is draining the queue
+} DeferredQueueType;
+
+static DeferredQueueType sDeferredQueue;
+static volatile RUINT32 sIrqNestingDepth; // handlers currently running with IRQs enabled (nested mode)
+static RUINT32 sFiqInterruptID = GIC_NO_FIQ_ID; // the only group 0 interrupt once FIQ is in use
+static GICInstanceType* sFiqInstance; // instance of the FIQ handler, for the fast FIQ vector
+#if GIC_PROFILE_ENABLE
+static GICProfileType sProfile; // only written from IRQ mode with IRQs masked
+#endif
+#if GIC_RATE_LIMIT_ENABLE
+static GICRateLimitType sRateLimit[GIC_MAX_NUMBER_OF_INTERRUPTS];
+#endif
 
 // static function prototypes
 static void HandlerVectorInitializer(GICInstanceType* GICInstance);
@@ -48,38 +110,82 @@ static RUINT32 readGICReg(RUINT32 offset);
 static void writeGICReg(RUINT32 data, RUINT32 offset);
 static void InitDistributor(void);
 static void DistributorEnableInterrupt(RUINT32 IntId);
+static void writeGICMaskRegs(const GICInterruptMaskType* pMask, RUINT32 baseOffset);
 static void InitCPUInterface(void);
 static void GICInterruptHandler(void* unusedData);
+static void GICFiqHandler(void* GICInstance);
 static GICResultEnum GICInstanceDefaultValueInitializer(GICInstanceType* GICInstance);
+static void DrainDeferredQueue(void) __attribute__((noinline));
+static void RunDeferredWork(void);
+static void modifyGICReg(RUINT32 clearMask, RUINT32 setMask, RUINT32 offset);
+#if GIC_HOST_MODEL
+static void DispatchNested(CallbackFunction Handler, void* Argument);
+#else
+static void DispatchNested(CallbackFunction Handler, void* Argument) __attribute__((naked, noinline));
+#endif
+#if GIC_PROFILE_ENABLE
+static void ProfileRecord(RUINT32 InterruptID, RUINT32 u4WaitCycles, RUINT32 u4RunCycles);
+#endif
+#if GIC_RATE_LIMIT_ENABLE
+static void RateLimitAccount(RUINT32 InterruptID);
+#endif
 
 //function prototypes
 
-// Driver Internal Linkage Functions (Static Functions - available to only current source file - cannot be linked via linker to any other file)
-static void IdleHandler(void* Argument)
+// handler of IDs nobody connected, also the default entry of static vector tables
+void GICIdleHandler(void* Argument)
 {
 	// place holder function
 	return;
 }
 
+// Driver Internal Linkage Functions (Static Functions - available to only current source file - cannot be linked via linker to any other file)
+
+// every register access of the driver goes through these two, offsets are relative to MPCORE_ADDRESS
 static RUINT32 readGICReg(RUINT32 offset)
 {
+#if GIC_HOST_MODEL
+	return GICHostModelRead(offset);
+#else
 	RUINT32 fullReadAddr = MPCORE_ADDRESS + offset;
-	return *(RUINT32 *)fullReadAddr;
+	return *(volatile RUINT32 *)fullReadAddr;
+#endif
 }
 
 static void writeGICReg(RUINT32 data, RUINT32 offset)
 {
+#if GIC_HOST_MODEL
+	GICHostModelWrite(data, offset);
+#else
 	RUINT32 fullReadAddr = MPCORE_ADDRESS + offset;
-	*(RUINT32 *)fullReadAddr = data;
+	*(volatile RUINT32 *)fullReadAddr = data;
+#endif
+}
+
+/*
+ * read - modify - write of a distributor register shared by several IDs, IRQ is masked so that
+ * an interrupt handler changing another ID of the same register cannot be lost
+ */
+static void modifyGICReg(RUINT32 clearMask, RUINT32 setMask, RUINT32 offset)
+{
+	RUINT32 u4SavedCpsr = mfcpsr();
+
+	mtcpsr(u4SavedCpsr | XIL_EXCEPTION_IRQ);
+	writeGICReg((readGICReg(offset) & ~clearMask) | setMask, offset);
+	mtcpsr(u4SavedCpsr);
 }
 
 static void HandlerVectorInitializer(GICInstanceType* GICInstance)
 {
+#if !GIC_STATIC_VECTOR_TABLE
 	for(RUINT32 u4Index = 0; u4Index < GIC_MAX_NUMBER_OF_INTERRUPTS; u4Index++)
 	{
-		GICInstance->InterruptHandlerVector[u4Index].CallBack = IdleHandler;
+		GICInstance->InterruptHandlerVector[u4Index].CallBack = GICIdleHandler;
 		GICInstance->InterruptHandlerVector[u4Index].CallBackArgumentSet = NULL;
 	}
+#else
+	(void)GICInstance; // handlers come from GICStaticVectorTable
+#endif
 }
 
 static void InitDistributor()
@@ -109,13 +215,13 @@ static void InitDistributor()
 
 	// set interrupt priority - to the lowest priority and all equal
 	// set 1 to all priority levels
-#define DEFAULT_PRIORTY_VALUE 0xa0a0a0a0U
+#define DEFAULT_PRIORTY_VALUE (GIC_DEFAULT_PRIORITY * 0x01010101U)
 	for(; u4Index<24; u4Index++)
 	{
 		writeGICReg(DEFAULT_PRIORTY_VALUE, ICDIPROffset(u4Index));
 	}
-#define DEFAULT_TARGET_CPU_0_VALUE 0x55555555
-	//set all interrupts to be targeted for CPU core 0 for this use case
+#define DEFAULT_TARGET_CPU_0_VALUE (GIC_CPU0_MASK * 0x01010101U)
+	//set all interrupts to be targeted for CPU core 0 for this use case, one byte per ID - bit 0 : CPU0, bit 1 : CPU1
 	for(u4Index = 0; u4Index<24; u4Index++)
 	{
 		writeGICReg(DEFAULT_TARGET_CPU_0_VALUE, ICDIPTROffset(u4Index));
@@ -131,6 +237,11 @@ static GICResultEnum GICInstanceDefaultValueInitializer(GICInstanceType* GICInst
 	if(GICInstance != NULL)
 	{
 		GICInstance->GICBaseAddr = MPCORE_ADDRESS;
+		GICInstance->u4ExceptionCount = 0U;
+		GICInstance->u4DispatchCount = 0U;
+		GICInstance->u4SpuriousCount = 0U;
+		GICInstance->u4NestingEnabled = 0U;
+		GICInstance->u4FiqCount = 0U;
 		HandlerVectorInitializer(GICInstance);
 		return GIC_SUCCESS;
 	}
@@ -154,8 +265,9 @@ static void InitCPUInterface(void)
 	value indicated by this field, the interface signals
 	the interrupt to the processor.
 	*/
-	writeGICReg(0xF0U,ICCPMR_OFFSET);
-	// dont need to set binary position register - use case, no preemption
+	writeGICReg(GIC_PRIORITY_MASK_VALUE,ICCPMR_OFFSET);
+	// binary point - all implemented priority bits are group priority, so any higher priority can preempt in nested mode
+	writeGICReg(GIC_DEFAULT_BINARY_POINT, ICCBPR_OFFSET);
 	//write to ICCICR to enable signalling of interrupt
 
 	u4TempValue = (rightShift(ICCICR_EnableS) | rightShift(ICCICR_EnableNS) | rightShift(ICCICR_AckCtl));
@@ -163,6 +275,146 @@ static void InitCPUInterface(void)
 
 }
 
+/*
+ * runs queued work items until the queue is empty. called in system mode with IRQs enabled,
+ * an interrupt taken here may post new items which are picked up by the same loop.
+ */
+static void DrainDeferredQueue(void)
+{
+	InterruptHandlerType WorkItem;
+
+	while(sDeferredQueue.u4Tail != sDeferredQueue.u4Head)
+	{
+		WorkItem = sDeferredQueue.Items[sDeferredQueue.u4Tail & (GIC_DEFERRED_QUEUE_SIZE - 1U)];
+		sDeferredQueue.u4Tail++;
+		WorkItem.CallBack(WorkItem.CallBackArgumentSet);
+	}
+}
+
+/*
+ * called at the end of IRQ handling, after EOI. Only the outermost interrupt level drains the queue.
+ * no stack variables are used here since Xil_EnableNestedInterrupts switches to system mode stack.
+ * queue is checked again with IRQs masked so that an item posted right before returning is not left behind.
+ */
+static void RunDeferredWork(void)
+{
+	if((sDeferredQueue.u4Running != 0U) || (sIrqNestingDepth != 0U))
+	{
+		// an interrupted level is already draining the queue or is still in a handler, it will run the new items
+		return;
+	}
+
+	sDeferredQueue.u4Running = 1U;
+	while(sDeferredQueue.u4Tail != sDeferredQueue.u4Head)
+	{
+		Xil_EnableNestedInterrupts();
+		DrainDeferredQueue();
+		Xil_DisableNestedInterrupts();
+	}
+	sDeferredQueue.u4Running = 0U;
+}
+
+/*
+ * calls Handler(Argument) in system mode with IRQs enabled and returns in IRQ mode with IRQs masked.
+ * same mode switch as Xil_EnableNestedInterrupts / Xil_DisableNestedInterrupts, done in one naked function
+ * so that compiled code never accesses its stack frame while system mode stack is in use.
+ * system mode stack is aligned to 8 bytes for the call as AAPCS requires.
+ */
+#if GIC_HOST_MODEL
+/*host build has no banked registers to protect, the model's nested interrupt switch is called around the handler*/
+static void DispatchNested(CallbackFunction Handler, void* Argument)
+{
+	Xil_EnableNestedInterrupts();
+	Handler(Argument);
+	Xil_DisableNestedInterrupts();
+}
+#else
+static void DispatchNested(CallbackFunction Handler, void* Argument)
+{
+	__asm__ __volatile__ (
+		"stmfd   sp!, {r4, lr}\n"		// IRQ mode lr - return address to caller, a nested IRQ overwrites it
+		"mrs     r4, spsr\n"
+		"stmfd   sp!, {r4}\n"			// a nested IRQ overwrites spsr
+		"msr     cpsr_c, #0x1F\n"		// system mode, IRQ enabled
+		"mov     r4, sp\n"
+		"bic     sp, sp, #7\n"
+		"stmfd   sp!, {r4, lr}\n"		// system mode sp before alignment, system mode lr
+		"mov     r2, r0\n"
+		"mov     r0, r1\n"
+		"blx     r2\n"
+		"ldmfd   sp!, {r4, lr}\n"
+		"mov     sp, r4\n"
+		"msr     cpsr_c, #0x92\n"		// IRQ mode, IRQ masked
+		"ldmfd   sp!, {r4}\n"
+		"msr     spsr_cxsf, r4\n"
+		"ldmfd   sp!, {r4, pc}\n"
+	);
+}
+#endif
+
+#if GIC_PROFILE_ENABLE
+/*
+ * called in IRQ mode with IRQs masked after the handler of InterruptID returned
+ */
+static void ProfileRecord(RUINT32 InterruptID, RUINT32 u4WaitCycles, RUINT32 u4RunCycles)
+{
+	GICProfileEntryType* pEntry = &sProfile.Entries[InterruptID];
+	RUINT32 u4Bucket = 0U;
+
+	// bucket n holds [2^n, 2^(n+1)) cycles, bucket 0 also holds 0, last bucket is open ended
+	if(u4RunCycles != 0U)
+	{
+		u4Bucket = 31U - (RUINT32)__builtin_clz(u4RunCycles);
+		if(u4Bucket >= GIC_PROFILE_HISTOGRAM_BUCKETS)
+		{
+			u4Bucket = GIC_PROFILE_HISTOGRAM_BUCKETS - 1U;
+		}
+	}
+
+	pEntry->u4Count++;
+	pEntry->au4Histogram[u4Bucket]++;
+	if(u4RunCycles > pEntry->u4MaxRunCycles)
+	{
+		pEntry->u4MaxRunCycles = u4RunCycles;
+	}
+	if(u4WaitCycles > pEntry->u4MaxWaitCycles)
+	{
+		pEntry->u4MaxWaitCycles = u4WaitCycles;
+	}
+}
+#endif
+
+#if GIC_RATE_LIMIT_ENABLE
+/*
+ * called in IRQ mode with IRQs masked after the handler of InterruptID returned.
+ * over the limit the ID is masked, EOI of the current dispatch is still written by the caller
+ */
+static void RateLimitAccount(RUINT32 InterruptID)
+{
+	GICRateLimitType* pRateLimit = &sRateLimit[InterruptID];
+
+	if(pRateLimit->u4MaxPerTick == 0U)
+	{
+		return;
+	}
+
+	pRateLimit->u4TickCount++;
+	if((pRateLimit->u4TickCount > pRateLimit->u4MaxPerTick) && (pRateLimit->u4Polling == 0U))
+	{
+		writeGICReg(rightShift(InterruptID % 32U), ICDICEROffset(InterruptID / 32U));
+		pRateLimit->u4Polling = 1U;
+		pRateLimit->u4QuietTicks = 0U;
+		pRateLimit->u4StormCount++;
+	}
+}
+#endif
+
+/*
+ * IRQ exception handler. interrupts that are pending when one handler returns are acknowledged
+ * and dispatched in the same exception (tail chaining), loop ends when ICCIAR reads spurious.
+ * every acknowledged ID gets its EOI before the next ICCIAR read, so running priority drops back
+ * and an interrupt of the same priority can be acknowledged.
+ */
 static void GICInterruptHandler(void* GICInstance)
 {
 	if(GICInstance != NULL)
@@ -171,52 +423,139 @@ static void GICInterruptHandler(void* GICInstance)
 		GICInstanceType* GICInstacePtr = (GICInstanceType*)GICInstance;
 		const RUINT32 InterruptMask = 0x3FFU;
 		RUINT32 u4InterruptAckValue;
+		RUINT32 u4DispatchCount = 0U;
+#if GIC_PROFILE_ENABLE
+		RUINT32 u4EntryCycle = PmuReadCycleCounter();
+		RUINT32 u4StartCycle;
 
-		// read interrupt ack register
-		u4InterruptAckValue = readGICReg(ICCIAR_OFFSET);
+		// exception levels active including this one
+		if((sIrqNestingDepth + 1U) > sProfile.u4MaxNestingDepth)
+		{
+			sProfile.u4MaxNestingDepth = sIrqNestingDepth + 1U;
+		}
+#endif
 
-		// retrieve the requesting interrupt ID
-		InterruptID = u4InterruptAckValue & InterruptMask;
-		if(InterruptID < GIC_MAX_NUMBER_OF_INTERRUPTS)
+		GICInstacePtr->u4ExceptionCount++;
+
+		for(;;)
 		{
-			CallbackFunction InterruptHandlerFunction = GICInstacePtr->InterruptHandlerVector[InterruptID].CallBack;
-			void*  InterruptHandlerFunctionArg = GICInstacePtr->InterruptHandlerVector[InterruptID].CallBackArgumentSet;
+			// read interrupt ack register
+			u4InterruptAckValue = readGICReg(ICCIAR_OFFSET);
+
+			// retrieve the requesting interrupt ID
+			InterruptID = u4InterruptAckValue & InterruptMask;
+			if(InterruptID == GIC_SPURIOUS_INTERRUPT_ID)
+			{
+				break;
+			}
+
+			if(InterruptID < GIC_MAX_NUMBER_OF_INTERRUPTS)
+			{
+				CallbackFunction InterruptHandlerFunction = GIC_VECTOR(GICInstacePtr, InterruptID).CallBack;
+				void*  InterruptHandlerFunctionArg = GIC_VECTOR(GICInstacePtr, InterruptID).CallBackArgumentSet;
+#if GIC_PROFILE_ENABLE
+				u4StartCycle = PmuReadCycleCounter();
+#endif
+
+				// call the interrupt request ID's handler function
+				if(GICInstacePtr->u4NestingEnabled != 0U)
+				{
+					// running priority is now this ID's priority, only higher priority IDs can preempt the handler
+					sIrqNestingDepth++;
+					DispatchNested(InterruptHandlerFunction, InterruptHandlerFunctionArg);
+					sIrqNestingDepth--;
+				}
+				else
+				{
+					InterruptHandlerFunction(InterruptHandlerFunctionArg);
+				}
+#if GIC_PROFILE_ENABLE
+				// wait : exception entry to handler start, includes handlers chained before this one
+				ProfileRecord(InterruptID, u4StartCycle - u4EntryCycle, PmuReadCycleCounter() - u4StartCycle);
+#endif
+#if GIC_RATE_LIMIT_ENABLE
+				RateLimitAccount(InterruptID);
+#endif
+			}
 
-			// call the interrupt request ID's handler function
-			InterruptHandlerFunction(InterruptHandlerFunctionArg);
+			// clear the interrupt for next interrupt request, CPUID field of SGIs is written back as well
+			writeGICReg(u4InterruptAckValue, ICCEOIR_OFFSET);
+			u4DispatchCount++;
+		}
 
-			// clear the interrupt for next interrupt request
-			writeGICReg(InterruptID, ICCEOIR_OFFSET);
+		// exception taken but interrupt was withdrawn or taken by another CPU before it was acknowledged
+		if(u4DispatchCount == 0U)
+		{
+			GICInstacePtr->u4SpuriousCount++;
 		}
+		GICInstacePtr->u4DispatchCount += u4DispatchCount;
+
+		// bottom half of the handlers, runs with IRQs enabled
+		RunDeferredWork();
 	}
 	return;
 }
 
-static void DistributorEnableInterrupt(RUINT32 IntId)
+/*
+ * FIQ exception handler. only one ID is group 0, so there is nothing to chain or queue :
+ * acknowledge, call, end. runs on the FIQ stack with FIQ masked, IRQ handlers can be preempted by it.
+ */
+static void GICFiqHandler(void* GICInstance)
+{
+	GICInstanceType* GICInstacePtr = (GICInstanceType*)GICInstance;
+	RUINT32 u4InterruptAckValue = readGICReg(ICCIAR_OFFSET);
+	RUINT32 InterruptID = u4InterruptAckValue & 0x3FFU;
+
+	if(InterruptID == GIC_SPURIOUS_INTERRUPT_ID)
+	{
+		return;
+	}
+
+	if(InterruptID < GIC_MAX_NUMBER_OF_INTERRUPTS)
+	{
+		GIC_VECTOR(GICInstacePtr, InterruptID).CallBack(GIC_VECTOR(GICInstacePtr, InterruptID).CallBackArgumentSet);
+	}
+
+	writeGICReg(u4InterruptAckValue, ICCEOIR_OFFSET);
+	GICInstacePtr->u4FiqCount++;
+}
+
+/**
+ * Entry of the fast FIQ vector, asm_vectors.S of the BSP built with XIL_FIQ_FAST_VECTOR=1 branches here directly
+ * instead of going through the Xil exception table, without saving VFP registers. FIQ handler must not use
+ * floating point. the standard vector reaches GICFiqHandler through the table, both work without changes here.
+ */
+void FIQFastInterrupt(void)
 {
-	RUINT32 u4ModBase = 32U;
-	RUINT32 u4TempRegisterOffset = 0;
-	RUINT32 u4TempBitOffset = 0;
-	RUINT32 u4TempReadRegister = 0;
-	RUINT32 u4TempBitSetter = 1U;
+	if(sFiqInstance != NULL)
+	{
+		GICFiqHandler(sFiqInstance);
+	}
+}
 
+static void DistributorEnableInterrupt(RUINT32 IntId)
+{
 	/*each ICDISER register is of size 32 bit
 	 * ICDISER0 -> 0:31
 	 * ICDISER1 -> 32:63
 	 * ICDISER2 -> 64:95
+	 * writing 1 sets the enable bit, 0 bits have no effect - no need to read it first
 	 * */
+	writeGICReg(rightShift(IntId % 32U), ICDISEROffset(IntId / 32U));
+}
 
-	u4TempBitOffset = IntId % u4ModBase;
-	u4TempRegisterOffset = IntId / u4ModBase;//((IntId - u4TempBitOffset) / u4ModBase) - 1U;
-
-	u4TempReadRegister = readGICReg(ICDISEROffset(u4TempRegisterOffset));
-
-	u4TempBitSetter <<= u4TempBitOffset;
-
-	u4TempReadRegister |= u4TempBitSetter;
-
-	writeGICReg(u4TempReadRegister, ICDISEROffset(u4TempRegisterOffset));
+/*writes each non zero word of the mask once to the register bank at baseOffset*/
+static void writeGICMaskRegs(const GICInterruptMaskType* pMask, RUINT32 baseOffset)
+{
+	RUINT32 u4Index;
 
+	for(u4Index = 0U; u4Index < GIC_INTERRUPT_MASK_WORDS; u4Index++)
+	{
+		if(pMask->au4Bits[u4Index] != 0U)
+		{
+			writeGICReg(pMask->au4Bits[u4Index], baseOffset + (RegisterSize * u4Index));
+		}
+	}
 }
 
 ////////////////////////////////////////////////////
@@ -236,6 +575,10 @@ GICResultEnum InitializeGIC(GICInstanceType* InstancePtr)
 		InitDistributor();
 		InitCPUInterface();
 		Status = GICInstanceDefaultValueInitializer(InstancePtr);
+#if GIC_PROFILE_ENABLE
+		PmuEnableCycleCounter();
+		GICResetProfile();
+#endif
 
 		// connect IRQ handler function to GIC handler function
 		Xil_ExceptionRegisterHandler(5U, (Xil_ExceptionHandler)GICInterruptHandler, InstancePtr);
@@ -244,15 +587,58 @@ GICResultEnum InitializeGIC(GICInstanceType* InstancePtr)
 	return Status;
 }
 
+/**
+ * Initializes GIC Instance on a secondary core (CPU1) after CPU0 has run InitializeGIC and StartGIC
+ * Only per CPU state is written : CPU interface and the banked priorities of SGIs / PPIs (ICDIPR0 - 7),
+ * distributor control, trigger, target and SPI priority registers shared with CPU0 are left untouched.
+ * IRQs are not unmasked, call Xil_ExceptionEnable once handlers are connected - not StartGIC, it writes ICDDCR.
+ */
+GICResultEnum InitializeGICCpuInterface(GICInstanceType* InstancePtr)
+{
+	GICResultEnum Status = GIC_FAILURE;
+	RUINT32 u4Index;
+
+	if(InstancePtr != NULL)
+	{
+		// IDs 0 - 31 are banked per CPU, reset value 0 would put them above the FIQ priority
+		for(u4Index = 0U; u4Index < 8U; u4Index++)
+		{
+			writeGICReg(DEFAULT_PRIORTY_VALUE, ICDIPROffset(u4Index));
+		}
+		InitCPUInterface();
+		Status = GICInstanceDefaultValueInitializer(InstancePtr);
+#if GIC_PROFILE_ENABLE
+		PmuEnableCycleCounter();
+		GICResetProfile();
+#endif
+
+		Xil_ExceptionRegisterHandler(5U, (Xil_ExceptionHandler)GICInterruptHandler, InstancePtr);
+	}
+
+	return Status;
+}
+
+/**
+ * Connects handler of an ID. With GIC_STATIC_VECTOR_TABLE the table is const, call only checks
+ * that GICStaticVectorTable holds the same handler and argument, so application code works in both modes.
+ */
 GICResultEnum GICConnectInterruptHandler(GICInstanceType* GICInstance, RUINT32 InterruptID, void* InterruptHandlerFunction, void* InterruptHandlerFunctionArgument)
 {
 	if(GICInstance != NULL)
 	{
 		if(InterruptID < GIC_MAX_NUMBER_OF_INTERRUPTS)
 		{
+#if GIC_STATIC_VECTOR_TABLE
+			if((GICStaticVectorTable[InterruptID].CallBack == (CallbackFunction)InterruptHandlerFunction) &&
+					(GICStaticVectorTable[InterruptID].CallBackArgumentSet == InterruptHandlerFunctionArgument))
+			{
+				return GIC_SUCCESS;
+			}
+#else
 			GICInstance->InterruptHandlerVector[InterruptID].CallBack = (CallbackFunction)InterruptHandlerFunction;
 			GICInstance->InterruptHandlerVector[InterruptID].CallBackArgumentSet = InterruptHandlerFunctionArgument;
 			return GIC_SUCCESS;
+#endif
 		}
 	}
 	return GIC_FAILURE;
@@ -268,16 +654,451 @@ GICResultEnum GICEnableInterruptID(RUINT32 u4InterruptIDToEnable)
 	if(u4InterruptIDToEnable < GIC_MAX_NUMBER_OF_INTERRUPTS)
 	{
 		DistributorEnableInterrupt(u4InterruptIDToEnable);
+		Status = GIC_SUCCESS;
 	}
 
 	return Status;
 
 }
 
+/**
+ * Enables every ID set in pMask, one ICDISER write per 32 IDs
+ */
+GICResultEnum GICEnableInterruptMask(const GICInterruptMaskType* pMask)
+{
+	if(pMask == NULL)
+	{
+		return GIC_FAILURE;
+	}
+
+	writeGICMaskRegs(pMask, ICDISER_BASE_OFFSET);
+
+	return GIC_SUCCESS;
+}
+
+/**
+ * Disables every ID set in pMask, one ICDICER write per 32 IDs. SGI enable bits are read only.
+ * an interrupt already signalled to the CPU can still be acknowledged after this returns.
+ */
+GICResultEnum GICDisableInterruptMask(const GICInterruptMaskType* pMask)
+{
+	if(pMask == NULL)
+	{
+		return GIC_FAILURE;
+	}
+
+	writeGICMaskRegs(pMask, ICDICER_BASE_OFFSET);
+	dsb(); // disable reaches the distributor before the caller goes on
+
+	return GIC_SUCCESS;
+}
+
+/**
+ * Clears pending state of every ID set in pMask, one ICDICPR write per 32 IDs.
+ * level sensitive IDs become pending again while their source keeps the line asserted.
+ */
+GICResultEnum GICClearPendingMask(const GICInterruptMaskType* pMask)
+{
+	if(pMask == NULL)
+	{
+		return GIC_FAILURE;
+	}
+
+	writeGICMaskRegs(pMask, ICDICPR_BASE_OFFSET);
+
+	return GIC_SUCCESS;
+}
+
+/**
+ * Sets the same priority to every ID set in pMask, see GICSetInterruptPriority.
+ * an ICDIPR whose 4 IDs are all in the mask is written without reading, others get one read-modify-write.
+ */
+GICResultEnum GICSetPriorityMask(const GICInterruptMaskType* pMask, RUINT8 u1Priority)
+{
+	RUINT32 u4Index;
+	RUINT32 u4Bits;
+	RUINT32 u4ByteMask;
+	RUINT32 u4PriorityValue;
+
+	if((pMask == NULL) || (u1Priority >= GIC_PRIORITY_MASK_VALUE))
+	{
+		return GIC_FAILURE;
+	}
+
+	u4PriorityValue = (RUINT32)u1Priority * 0x01010101U;
+
+	// 4 IDs per ICDIPR, one byte each - 8 ICDIPRs per mask word
+	for(u4Index = 0U; u4Index < (GIC_INTERRUPT_MASK_WORDS * 8U); u4Index++)
+	{
+		u4Bits = (pMask->au4Bits[u4Index / 8U] >> ((u4Index % 8U) * 4U)) & 0x0FU;
+		if(u4Bits == 0x0FU)
+		{
+			writeGICReg(u4PriorityValue, ICDIPROffset(u4Index));
+		}
+		else if(u4Bits != 0U)
+		{
+			u4ByteMask = ((u4Bits & 0x01U) ? 0x000000FFU : 0U) | ((u4Bits & 0x02U) ? 0x0000FF00U : 0U) |
+					((u4Bits & 0x04U) ? 0x00FF0000U : 0U) | ((u4Bits & 0x08U) ? 0xFF000000U : 0U);
+			modifyGICReg(u4ByteMask, u4PriorityValue & u4ByteMask, ICDIPROffset(u4Index));
+		}
+	}
+
+	return GIC_SUCCESS;
+}
+
+/**
+ * Queues WorkFunction(WorkArgument) to be run after the current interrupt is completed,
+ * with IRQs enabled. Can be called from any interrupt handler or from deferred work.
+ * Returns GIC_FAILURE if the queue is full.
+ */
+GICResultEnum GICPostDeferredWork(CallbackFunction WorkFunction, void* WorkArgument)
+{
+	GICResultEnum Status = GIC_FAILURE;
+	RUINT32 u4SavedCpsr;
+
+	if(WorkFunction != NULL)
+	{
+		// mask IRQ so that nested handlers cannot post into the same slot
+		u4SavedCpsr = mfcpsr();
+		mtcpsr(u4SavedCpsr | XIL_EXCEPTION_IRQ);
+
+		if((sDeferredQueue.u4Head - sDeferredQueue.u4Tail) < GIC_DEFERRED_QUEUE_SIZE)
+		{
+			sDeferredQueue.Items[sDeferredQueue.u4Head & (GIC_DEFERRED_QUEUE_SIZE - 1U)].CallBack = WorkFunction;
+			sDeferredQueue.Items[sDeferredQueue.u4Head & (GIC_DEFERRED_QUEUE_SIZE - 1U)].CallBackArgumentSet = WorkArgument;
+			sDeferredQueue.u4Head++;
+			Status = GIC_SUCCESS;
+		}
+
+		mtcpsr(u4SavedCpsr);
+	}
+
+	return Status;
+}
+
+/**
+ * Sets priority of an interrupt ID, lower value is higher priority.
+ * Only upper 5 bits are implemented (steps of 8), values from GIC_PRIORITY_MASK_VALUE on are never signalled.
+ */
+GICResultEnum GICSetInterruptPriority(RUINT32 u4InterruptID, RUINT8 u1Priority)
+{
+	RUINT32 u4Shift;
+
+	if((u4InterruptID >= GIC_MAX_NUMBER_OF_INTERRUPTS) || (u1Priority >= GIC_PRIORITY_MASK_VALUE))
+	{
+		return GIC_FAILURE;
+	}
+
+	// 4 IDs per ICDIPR, one byte each
+	u4Shift = (u4InterruptID % 4U) * 8U;
+	modifyGICReg(0xFFU << u4Shift, (RUINT32)u1Priority << u4Shift, ICDIPROffset(u4InterruptID / 4U));
+
+	return GIC_SUCCESS;
+}
+
+/**
+ * Sets trigger type of a shared peripheral interrupt. change it while the ID is disabled.
+ */
+GICResultEnum GICSetInterruptTrigger(RUINT32 u4InterruptID, GICTriggerType Trigger)
+{
+	RUINT32 u4Shift;
+
+	if((u4InterruptID < GIC_FIRST_SPI_ID) || (u4InterruptID >= GIC_MAX_NUMBER_OF_INTERRUPTS) ||
+			((Trigger != GIC_TRIGGER_LEVEL_HIGH) && (Trigger != GIC_TRIGGER_RISING_EDGE)))
+	{
+		return GIC_FAILURE;
+	}
+
+	// 16 IDs per ICDICFR, two bits each
+	u4Shift = (u4InterruptID % 16U) * 2U;
+	modifyGICReg(0x03U << u4Shift, (RUINT32)Trigger << u4Shift, ICDFROffset(u4InterruptID / 16U));
+
+	return GIC_SUCCESS;
+}
+
+/**
+ * Routes a shared peripheral interrupt to the CPUs in u1CpuMask (GIC_CPU0_MASK / GIC_CPU1_MASK).
+ * with both bits set the first CPU to acknowledge handles it.
+ */
+GICResultEnum GICSetInterruptTarget(RUINT32 u4InterruptID, RUINT8 u1CpuMask)
+{
+	RUINT32 u4Shift;
+
+	if((u4InterruptID < GIC_FIRST_SPI_ID) || (u4InterruptID >= GIC_MAX_NUMBER_OF_INTERRUPTS) ||
+			(u1CpuMask == 0U) || ((u1CpuMask & ~GIC_CPU_MASK_ALL) != 0U))
+	{
+		return GIC_FAILURE;
+	}
+
+	// 4 IDs per ICDIPTR, one byte each
+	u4Shift = (u4InterruptID % 4U) * 8U;
+	modifyGICReg(0xFFU << u4Shift, (RUINT32)u1CpuMask << u4Shift, ICDIPTROffset(u4InterruptID / 4U));
+
+	return GIC_SUCCESS;
+}
+
+/**
+ * Raises software generated interrupt u4SgiID on the CPUs in u1CpuMask, sending CPU can be in the mask.
+ * data written before the call is visible to the target CPUs when they take the interrupt.
+ */
+GICResultEnum GICSendSoftwareInterrupt(RUINT32 u4SgiID, RUINT8 u1CpuMask)
+{
+	RUINT32 u4SgiValue;
+
+	if((u4SgiID >= GIC_NUMBER_OF_SGIS) || (u1CpuMask == 0U) || ((u1CpuMask & ~GIC_CPU_MASK_ALL) != 0U))
+	{
+		return GIC_FAILURE;
+	}
+
+	u4SgiValue = ((RUINT32)u1CpuMask << ICDSGIR_TARGET_LIST_SHIFT) | u4SgiID;
+	// once FIQ is in use SGIs are group 1, a secure write only forwards them with SATT set.
+	// both cores have to use the same group for an SGI, group is read from this core's bank
+	if((readGICReg(ICDISROffset(0U)) & rightShift(u4SgiID)) != 0U)
+	{
+		u4SgiValue |= rightShift(ICDSGIR_SATT);
+	}
+
+	dsb();
+	writeGICReg(u4SgiValue, ICDSGIR_OFFSET);
+
+	return GIC_SUCCESS;
+}
+
+/**
+ * Routes one interrupt ID to FIQ : the ID is made group 0 with the highest priority and every other ID
+ * group 1, which is still signalled as IRQ and dispatched by GICInterruptHandler. FIQ handler skips the
+ * generic IRQ path (tail chain loop, nesting, profiling, deferred work), it must be short and must not
+ * call GICPostDeferredWork. Only one ID can use FIQ, call again with the same ID to change the handler.
+ */
+GICResultEnum GICConnectFiqHandler(GICInstanceType* GICInstance, RUINT32 InterruptID, void* InterruptHandlerFunction, void* InterruptHandlerFunctionArgument)
+{
+	RUINT32 u4Index;
+
+	if((GICInstance == NULL) || (InterruptHandlerFunction == NULL) || (InterruptID < GIC_NUMBER_OF_SGIS) ||
+			(InterruptID >= GIC_MAX_NUMBER_OF_INTERRUPTS))
+	{
+		return GIC_FAILURE;
+	}
+	if((sFiqInterruptID != GIC_NO_FIQ_ID) && (sFiqInterruptID != InterruptID))
+	{
+		return GIC_FAILURE;
+	}
+
+	// IRQ dispatch can still acknowledge the ID if it reads ICCIAR first, same handler is used there
+	if(GICConnectInterruptHandler(GICInstance, InterruptID, InterruptHandlerFunction, InterruptHandlerFunctionArgument) != GIC_SUCCESS)
+	{
+		return GIC_FAILURE;
+	}
+	sFiqInterruptID = InterruptID;
+	sFiqInstance = GICInstance;
+	(void)GICSetInterruptPriority(InterruptID, GIC_FIQ_PRIORITY);
+
+	// every ID except the FIQ one becomes group 1
+	for(u4Index = 0U; u4Index < ICDISR_COUNT; u4Index++)
+	{
+		writeGICReg(0xFFFFFFFFU, ICDISROffset(u4Index));
+	}
+	modifyGICReg(rightShift(InterruptID % 32U), 0U, ICDISROffset(InterruptID / 32U));
+	// distributor forwards group 1 as well, otherwise every ID but the FIQ one stops here
+	modifyGICReg(0U, rightShift(ICDDCR_EnableNS), ICDDCR_OFFSET);
+
+	// group 0 as FIQ, secure binary point for both groups so GICSetBinaryPoint keeps applying to IRQs
+	modifyGICReg(0U, rightShift(ICCICR_FIQEn) | rightShift(ICCICR_SBPR), ICCICR_OFFSET);
+
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_FIQ_INT, (Xil_ExceptionHandler)GICFiqHandler, GICInstance);
+	Xil_ExceptionEnableMask(XIL_EXCEPTION_FIQ);
+
+	return GIC_SUCCESS;
+}
+
+/**
+ * Sets ICCBPR. priority bits above the binary point are group priority, only a higher group priority preempts.
+ */
+GICResultEnum GICSetBinaryPoint(RUINT32 u4BinaryPoint)
+{
+	if(u4BinaryPoint > GIC_MAX_BINARY_POINT)
+	{
+		return GIC_FAILURE;
+	}
+
+	writeGICReg(u4BinaryPoint, ICCBPR_OFFSET);
+	return GIC_SUCCESS;
+}
+
+/**
+ * Nested mode : handlers run with IRQs enabled at the CPU after their ID is acknowledged, so an
+ * interrupt with higher group priority preempts a running handler. Handlers must be reentrant safe
+ * against higher priority handlers and use the system mode stack, which has to be sized for nesting.
+ */
+GICResultEnum GICSetNestedMode(GICInstanceType* GICInstance, RUINT32 u4Enable)
+{
+	if(GICInstance == NULL)
+	{
+		return GIC_FAILURE;
+	}
+
+	GICInstance->u4NestingEnabled = (u4Enable != 0U) ? 1U : 0U;
+	return GIC_SUCCESS;
+}
+
+#if GIC_PROFILE_ENABLE
+/**
+ * Copies profile data of all IDs to pProfile. IRQ is masked during the copy, so the snapshot is consistent.
+ */
+GICResultEnum GICGetProfile(GICProfileType* pProfile)
+{
+	RUINT32 u4SavedCpsr;
+
+	if(pProfile == NULL)
+	{
+		return GIC_FAILURE;
+	}
+
+	u4SavedCpsr = mfcpsr();
+	mtcpsr(u4SavedCpsr | XIL_EXCEPTION_IRQ);
+	*pProfile = sProfile;
+	mtcpsr(u4SavedCpsr);
+
+	return GIC_SUCCESS;
+}
+
+/**
+ * Clears profile data of all IDs and maximum nesting depth
+ */
+void GICResetProfile(void)
+{
+	RUINT32 u4SavedCpsr = mfcpsr();
+
+	mtcpsr(u4SavedCpsr | XIL_EXCEPTION_IRQ);
+	memset(&sProfile, 0, sizeof(sProfile));
+	mtcpsr(u4SavedCpsr);
+}
+#endif
+
+#if GIC_RATE_LIMIT_ENABLE
+/**
+ * Poll timer tick, handler of GIC_POLL_TIMER_ID. starts a new rate window for limited IDs and calls the
+ * handler of every masked ID that is pending. a masked ID found idle GIC_RATE_LIMIT_QUIET_TICKS times in a
+ * row is unmasked again. polled handlers run like dispatched ones, they can post deferred work.
+ */
+void GICPollTimerHandler(void* GICInstance)
+{
+	GICInstanceType* GICInstacePtr = (GICInstanceType*)GICInstance;
+	GICRateLimitType* pRateLimit;
+	RUINT32 InterruptID;
+	RUINT32 u4Bit;
+
+#if GIC_STATIC_VECTOR_TABLE
+	(void)GICInstacePtr; // handlers come from GICStaticVectorTable
+#endif
+	writeGICReg(0x01U, PTISR_OFFSET);
+
+	for(InterruptID = GIC_NUMBER_OF_SGIS; InterruptID < GIC_MAX_NUMBER_OF_INTERRUPTS; InterruptID++)
+	{
+		pRateLimit = &sRateLimit[InterruptID];
+		pRateLimit->u4TickCount = 0U;
+		if(pRateLimit->u4Polling == 0U)
+		{
+			continue;
+		}
+
+		u4Bit = rightShift(InterruptID % 32U);
+		if((readGICReg(ICDISPROffset(InterruptID / 32U)) & u4Bit) != 0U)
+		{
+			// an edge latched while masked is consumed here, a level source pends again until its handler clears it
+			writeGICReg(u4Bit, ICDICPROffset(InterruptID / 32U));
+			GIC_VECTOR(GICInstacePtr, InterruptID).CallBack(GIC_VECTOR(GICInstacePtr, InterruptID).CallBackArgumentSet);
+			pRateLimit->u4PollCount++;
+			pRateLimit->u4QuietTicks = 0U;
+		}
+		else if(++pRateLimit->u4QuietTicks >= GIC_RATE_LIMIT_QUIET_TICKS)
+		{
+			pRateLimit->u4Polling = 0U;
+			writeGICReg(u4Bit, ICDISEROffset(InterruptID / 32U));
+		}
+	}
+}
+
+/**
+ * Starts the private timer of this CPU as poll timer with a tick every u4PeriodUs microseconds.
+ * a tick is the rate window of GICSetRateLimit and the polling period of masked IDs.
+ */
+GICResultEnum GICStartPollTimer(GICInstanceType* GICInstance, RUINT32 u4PeriodUs)
+{
+	if((GICInstance == NULL) || (u4PeriodUs == 0U) || (u4PeriodUs > (0xFFFFFFFFU / PRIVATE_TIMER_TICKS_PER_US)))
+	{
+		return GIC_FAILURE;
+	}
+	if(GICConnectInterruptHandler(GICInstance, GIC_POLL_TIMER_ID, GICPollTimerHandler, GICInstance) != GIC_SUCCESS)
+	{
+		return GIC_FAILURE;
+	}
+
+	writeGICReg(0U, PTCTLR_OFFSET);
+	writeGICReg((u4PeriodUs * PRIVATE_TIMER_TICKS_PER_US) - 1U, PTLR_OFFSET);
+	writeGICReg(0x01U, PTISR_OFFSET);
+	writeGICReg(rightShift(PTCTLR_ENABLE) | rightShift(PTCTLR_AUTO_RELOAD) | rightShift(PTCTLR_IRQ_ENABLE), PTCTLR_OFFSET);
+	DistributorEnableInterrupt(GIC_POLL_TIMER_ID);
+
+	return GIC_SUCCESS;
+}
+
+/**
+ * Limits an interrupt ID to u4MaxPerTick dispatches per poll timer tick, 0 removes the limit and
+ * unmasks the ID if it is being polled. SGIs, the poll timer and the FIQ ID cannot be limited.
+ */
+GICResultEnum GICSetRateLimit(RUINT32 u4InterruptID, RUINT32 u4MaxPerTick)
+{
+	GICRateLimitType* pRateLimit;
+	RUINT32 u4SavedCpsr;
+
+	if((u4InterruptID < GIC_NUMBER_OF_SGIS) || (u4InterruptID >= GIC_MAX_NUMBER_OF_INTERRUPTS) ||
+			(u4InterruptID == GIC_POLL_TIMER_ID) || (u4InterruptID == sFiqInterruptID))
+	{
+		return GIC_FAILURE;
+	}
+
+	pRateLimit = &sRateLimit[u4InterruptID];
+
+	u4SavedCpsr = mfcpsr();
+	mtcpsr(u4SavedCpsr | XIL_EXCEPTION_IRQ);
+	pRateLimit->u4MaxPerTick = u4MaxPerTick;
+	pRateLimit->u4TickCount = 0U;
+	if((u4MaxPerTick == 0U) && (pRateLimit->u4Polling != 0U))
+	{
+		pRateLimit->u4Polling = 0U;
+		writeGICReg(rightShift(u4InterruptID % 32U), ICDISEROffset(u4InterruptID / 32U));
+	}
+	mtcpsr(u4SavedCpsr);
+
+	return GIC_SUCCESS;
+}
+
+/**
+ * Copies rate limit state and counters of an interrupt ID to pRateLimit
+ */
+GICResultEnum GICGetRateLimit(RUINT32 u4InterruptID, GICRateLimitType* pRateLimit)
+{
+	RUINT32 u4SavedCpsr;
+
+	if((pRateLimit == NULL) || (u4InterruptID >= GIC_MAX_NUMBER_OF_INTERRUPTS))
+	{
+		return GIC_FAILURE;
+	}
+
+	u4SavedCpsr = mfcpsr();
+	mtcpsr(u4SavedCpsr | XIL_EXCEPTION_IRQ);
+	*pRateLimit = sRateLimit[u4InterruptID];
+	mtcpsr(u4SavedCpsr);
+
+	return GIC_SUCCESS;
+}
+#endif
+
 void StartGIC(void)
 {
-	// enables distributor
-	writeGICReg(1U, ICDDCR_OFFSET);
+	// enables distributor for both groups, all IDs are group 0 until GICConnectFiqHandler moves them to group 1
+	writeGICReg(rightShift(ICDDCR_EnableS) | rightShift(ICDDCR_EnableNS), ICDDCR_OFFSET);
 	// enables exceptions to fire up (such as IRQ)
 	Xil_ExceptionEnable();
 }
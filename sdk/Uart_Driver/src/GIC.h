@@ -11,6 +11,58 @@
 #include "CommonTypes.h"
 
 #define GIC_MAX_NUMBER_OF_INTERRUPTS 96
+#define GIC_DEFERRED_QUEUE_SIZE 32U // number of deferred work items, must be power of two
+#define GIC_DEFAULT_PRIORITY 0xA0U // priority of all IDs after InitializeGIC
+#define GIC_DEFAULT_BINARY_POINT 2U // group priority is bits [7:3], all 5 implemented priority bits
+#define GIC_MAX_BINARY_POINT 7U
+#define GIC_FIQ_PRIORITY 0x00U // priority of the FIQ ID, above every IRQ so it is signalled while IRQ handlers run
+#define GIC_NUMBER_OF_SGIS 16U // IDs 0 - 15 are software generated interrupts, always enabled
+#define GIC_CPU0_MASK 0x01U
+#define GIC_CPU1_MASK 0x02U
+#define GIC_CPU_MASK_ALL (GIC_CPU0_MASK | GIC_CPU1_MASK)
+
+/*per ID handler timing in CPU cycles, build with GIC_PROFILE_ENABLE=1 to compile it in*/
+#ifndef GIC_PROFILE_ENABLE
+#define GIC_PROFILE_ENABLE 0
+#endif
+/*
+ * build with GIC_STATIC_VECTOR_TABLE=1 to dispatch from a const table defined by the application :
+ * const InterruptHandlerType GICStaticVectorTable[GIC_MAX_NUMBER_OF_INTERRUPTS] GIC_VECTOR_TABLE_SECTION = {
+ *     GIC_VECTOR_TABLE_DEFAULTS,
+ *     [82] = { (CallbackFunction)Handler, &Argument },
+ * };
+ * later designated initializers override the default entry (GCC range initializer), wrap the definition in
+ * #pragma GCC diagnostic push / ignored "-Woverride-init" / pop to keep -Wextra builds quiet.
+ */
+#ifndef GIC_STATIC_VECTOR_TABLE
+#define GIC_STATIC_VECTOR_TABLE 0
+#endif
+#define GIC_VECTOR_TABLE_DEFAULTS [0 ... (GIC_MAX_NUMBER_OF_INTERRUPTS - 1)] = { GICIdleHandler, NULL }
+#define GIC_VECTOR_TABLE_SECTION __attribute__((section(".rodata.gic_vectors"), aligned(32))) // cache line aligned
+#define GIC_PROFILE_HISTOGRAM_BUCKETS 24U // log2 buckets, last one collects everything from 2^23 cycles on
+/*
+ * interrupt storm limiting, build with GIC_RATE_LIMIT_ENABLE=1 to compile it in. an ID that is dispatched more
+ * than its limit within one poll timer tick is masked and its handler is called from the poll timer while the
+ * ID is pending. it is unmasked after GIC_RATE_LIMIT_QUIET_TICKS polls in a row found it idle.
+ * with GIC_STATIC_VECTOR_TABLE the table needs [GIC_POLL_TIMER_ID] = { GICPollTimerHandler, &Instance }.
+ */
+#ifndef GIC_RATE_LIMIT_ENABLE
+#define GIC_RATE_LIMIT_ENABLE 0
+#endif
+#define GIC_POLL_TIMER_ID 29U // private timer PPI of this CPU
+#define GIC_RATE_LIMIT_QUIET_TICKS 2U
+/*
+ * build with GIC_HOST_MODEL=1 to route the driver's register accesses to GICHostModelRead / GICHostModelWrite
+ * instead of the memory mapped MPCore registers. the build provides them, e.g. a model of the distributor and
+ * CPU interface that decides what ICCIAR returns. offsets are relative to the MPCore base (0xF8F00000).
+ */
+#ifndef GIC_HOST_MODEL
+#define GIC_HOST_MODEL 0
+#endif
+#define GIC_INTERRUPT_MASK_WORDS ((GIC_MAX_NUMBER_OF_INTERRUPTS + 31U) / 32U)
+/*GICInterruptMaskType helpers*/
+#define GIC_MASK_SET(MaskPtr, ID) ((MaskPtr)->au4Bits[(ID) / 32U] |= (1U << ((ID) % 32U)))
+#define GIC_MASK_CLEAR(MaskPtr, ID) ((MaskPtr)->au4Bits[(ID) / 32U] &= ~(1U << ((ID) % 32U)))
 
 typedef void (*CallbackFunction)(void* Argument);
 typedef void (*InterruptHandlerFunc)(void);
@@ -23,9 +75,55 @@ typedef struct {
 typedef struct {
 	RUINT32 GICBaseAddr;
 	RUINT32 IsInitialized;
+#if !GIC_STATIC_VECTOR_TABLE
 	InterruptHandlerType InterruptHandlerVector[GIC_MAX_NUMBER_OF_INTERRUPTS];
+#endif
+	/*
+	 * IRQ counters - exception entries saved by tail chaining : u4DispatchCount - (u4ExceptionCount - u4SpuriousCount)
+	 */
+	RUINT32 u4ExceptionCount; // IRQ exceptions taken
+	RUINT32 u4DispatchCount; // interrupt IDs acknowledged and ended
+	RUINT32 u4SpuriousCount; // exceptions that found nothing to acknowledge
+	RUINT32 u4NestingEnabled; // set by GICSetNestedMode
+	RUINT32 u4FiqCount; // FIQ exceptions that dispatched the FIQ ID
 }GICInstanceType;
 
+/*bitmap of interrupt IDs for the bulk APIs, bit n of au4Bits[w] is ID (w * 32) + n - one word per distributor register*/
+typedef struct {
+	RUINT32 au4Bits[GIC_INTERRUPT_MASK_WORDS];
+}GICInterruptMaskType;
+
+/*ICDICFR field values for shared peripheral interrupts*/
+typedef enum {
+	GIC_TRIGGER_LEVEL_HIGH = 1,
+	GIC_TRIGGER_RISING_EDGE = 3
+}GICTriggerType;
+
+/*
+ * handler run time is measured around the handler call, in nested mode it includes handlers that preempted it.
+ * wait time is from IRQ exception entry to handler call, it includes handlers chained before in the same exception.
+ */
+typedef struct {
+	RUINT32 u4Count; // handler calls
+	RUINT32 u4MaxRunCycles;
+	RUINT32 u4MaxWaitCycles;
+	RUINT32 au4Histogram[GIC_PROFILE_HISTOGRAM_BUCKETS]; // bucket n : run time in [2^n, 2^(n+1)) cycles
+}GICProfileEntryType;
+
+typedef struct {
+	GICProfileEntryType Entries[GIC_MAX_NUMBER_OF_INTERRUPTS];
+	RUINT32 u4MaxNestingDepth; // most IRQ exception levels active at once
+}GICProfileType;
+
+typedef struct {
+	RUINT32 u4MaxPerTick; // dispatches allowed in one poll timer tick, 0 : not limited
+	RUINT32 u4TickCount; // dispatches in the current tick
+	RUINT32 u4Polling; // 1 : masked, serviced by the poll timer
+	RUINT32 u4QuietTicks; // polls in a row that found the ID idle
+	RUINT32 u4StormCount; // times the ID was masked
+	RUINT32 u4PollCount; // handler calls made by the poll timer
+}GICRateLimitType;
+
 typedef enum {
 	GIC_SUCCESS = 0,
 	GIC_FAILURE = 1,
@@ -34,9 +132,44 @@ typedef enum {
 
 
 
+#if GIC_STATIC_VECTOR_TABLE
+extern const InterruptHandlerType GICStaticVectorTable[GIC_MAX_NUMBER_OF_INTERRUPTS];
+#endif
+#if GIC_HOST_MODEL
+RUINT32 GICHostModelRead(RUINT32 u4Offset);
+void GICHostModelWrite(RUINT32 u4Data, RUINT32 u4Offset);
+#endif
+
+void GICIdleHandler(void* Argument);
 GICResultEnum InitializeGIC(GICInstanceType* InstancePtr);
+GICResultEnum InitializeGICCpuInterface(GICInstanceType* InstancePtr);
 GICResultEnum GICInstanceInitializer(GICInstanceType* GICInstance);
 GICResultEnum GICConnectInterruptHandler(GICInstanceType* GICInstance, RUINT32 InterruptID, void* InterruptHandlerFunction, void* InterruptHandlerFunctionArgument);
 void ConnectInterruptHandler(RUINT32 IntId, InterruptHandlerFunc HandlerFunc);
+GICResultEnum GICEnableInterruptID(RUINT32 u4InterruptIDToEnable);
+GICResultEnum GICEnableInterruptMask(const GICInterruptMaskType* pMask);
+GICResultEnum GICDisableInterruptMask(const GICInterruptMaskType* pMask);
+GICResultEnum GICClearPendingMask(const GICInterruptMaskType* pMask);
+GICResultEnum GICSetPriorityMask(const GICInterruptMaskType* pMask, RUINT8 u1Priority);
+GICResultEnum GICSetInterruptPriority(RUINT32 u4InterruptID, RUINT8 u1Priority);
+GICResultEnum GICSetInterruptTrigger(RUINT32 u4InterruptID, GICTriggerType Trigger);
+GICResultEnum GICConnectFiqHandler(GICInstanceType* GICInstance, RUINT32 InterruptID, void* InterruptHandlerFunction, void* InterruptHandlerFunctionArgument);
+GICResultEnum GICSetInterruptTarget(RUINT32 u4InterruptID, RUINT8 u1CpuMask);
+GICResultEnum GICSendSoftwareInterrupt(RUINT32 u4SgiID, RUINT8 u1CpuMask);
+GICResultEnum GICSetBinaryPoint(RUINT32 u4BinaryPoint);
+GICResultEnum GICSetNestedMode(GICInstanceType* GICInstance, RUINT32 u4Enable);
+#if GIC_PROFILE_ENABLE
+GICResultEnum GICGetProfile(GICProfileType* pProfile);
+void GICResetProfile(void);
+#endif
+#if GIC_RATE_LIMIT_ENABLE
+void GICPollTimerHandler(void* GICInstance);
+GICResultEnum GICStartPollTimer(GICInstanceType* GICInstance, RUINT32 u4PeriodUs);
+GICResultEnum GICSetRateLimit(RUINT32 u4InterruptID, RUINT32 u4MaxPerTick);
+GICResultEnum GICGetRateLimit(RUINT32 u4InterruptID, GICRateLimitType* pRateLimit);
+#endif
+void StartGIC(void);
+void FIQFastInterrupt(void);
+GICResultEnum GICPostDeferredWork(CallbackFunction WorkFunction, void* WorkArgument);
 
 #endif /* SRC_GIC_H_ */
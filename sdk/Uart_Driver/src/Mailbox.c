@@ -0,0 +1,147 @@
+/*
+ * Mailbox.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * Inter core mailbox between the two Cortex-A9 cores
+ * One single producer / single consumer message ring per receiving CPU lives in OCM, section .ocm_mailbox
+ * of the linker script, so both core images find it at the same address. OCM is mapped non cacheable
+ * by MailboxInitialize since L1 caches of the cores are not kept coherent in standalone mode.
+ * Sender writes the message, publishes the new head and raises MAILBOX_SGI_ID on the receiving CPU.
+ * Receiver connects a handler to MAILBOX_SGI_ID with GICConnectInterruptHandler and calls MailboxReceive
+ * until MAILBOX_EMPTY - several messages can arrive with one SGI.
+ * Only CPU0 initializes the distributor (InitializeGIC), CPU1 sets up its own CPU interface only
+ * (InitializeGICCpuInterface). SGIs are always enabled, CPU1 does not need to write ICDISER.
+ * The non cacheable mapping covers the whole 1 MB section 0xFFF00000 - 0xFFFFFFFF, anything else linked
+ * to ps7_ram_1 by either core image loses caching too.
+ */
+
+/**************Includes******************/
+#include <string.h>
+#include "Mailbox.h"
+#include "GIC.h"
+#include "xil_mmu.h"
+#include "xpseudo_asm.h"
+
+/**************Preprocessor******************/
+#define MAILBOX_MAGIC 0x4D424F58U // "MBOX", set once channels are reset
+#define MPIDR_CPU_ID_MASK 0x03U
+
+/**************Definitions******************/
+/*head and tail are on separate 32 byte lines, each is written by one core only*/
+typedef struct {
+	volatile RUINT32 u4Head; // written by sender
+	RUINT32 au4Reserved0[7];
+	volatile RUINT32 u4Tail; // written by receiver
+	RUINT32 au4Reserved1[7];
+	MailboxMessageType Slots[MAILBOX_SLOT_COUNT];
+} MailboxChannelType;
+
+typedef struct {
+	volatile RUINT32 u4Magic;
+	RUINT32 au4Reserved[7];
+	MailboxChannelType Channels[MAILBOX_NUMBER_OF_CPUS]; // index is the receiving CPU
+} MailboxType;
+
+static MailboxType sMailbox __attribute__((section(".ocm_mailbox"), aligned(32)));
+
+
+/*
+ * returns CPU number of the calling core from MPIDR
+ */
+RUINT32 MailboxGetCpuId(void)
+{
+	return (RUINT32)mfcp(XREG_CP15_MULTI_PROC_AFFINITY) & MPIDR_CPU_ID_MASK;
+}
+
+/*
+ * maps mailbox memory non cacheable for the calling core. to be called on both cores, CPU0 calls it with
+ * u4ResetChannels = 1 before CPU1 is started, CPU1 calls it with 0.
+ */
+MailboxResultType MailboxInitialize(RUINT32 u4ResetChannels)
+{
+	// attribute is set for the whole 1 MB section holding the mailbox (0xFFF00000 - 0xFFFFFFFF), not just sMailbox -
+	// all of high OCM (ps7_ram_1) and the CPU1 boot loop at 0xFFFFFE00 become non cacheable for this core
+	Xil_SetTlbAttributes((INTPTR)&sMailbox, NORM_NONCACHE);
+
+	if(u4ResetChannels != 0U)
+	{
+		memset((void *)&sMailbox, 0, sizeof(sMailbox));
+		dmb();
+		sMailbox.u4Magic = MAILBOX_MAGIC;
+		dsb();
+	}
+	else if(sMailbox.u4Magic != MAILBOX_MAGIC)
+	{
+		// CPU0 has not set up the mailbox yet
+		return MAILBOX_FAILURE;
+	}
+
+	return MAILBOX_SUCCESS;
+}
+
+/*
+ * queues pMessage to u4TargetCpu and signals it with MAILBOX_SGI_ID. does not block.
+ * only one context per core may send to the same target.
+ */
+MailboxResultType MailboxSend(RUINT32 u4TargetCpu, const MailboxMessageType *pMessage)
+{
+	MailboxChannelType *pChannel;
+	RUINT32 u4Head;
+
+	if((u4TargetCpu >= MAILBOX_NUMBER_OF_CPUS) || (pMessage == NULL) || (u4TargetCpu == MailboxGetCpuId()))
+	{
+		return MAILBOX_FAILURE;
+	}
+
+	pChannel = &sMailbox.Channels[u4TargetCpu];
+	u4Head = pChannel->u4Head;
+	if((u4Head - pChannel->u4Tail) >= MAILBOX_SLOT_COUNT)
+	{
+		return MAILBOX_FULL;
+	}
+
+	pChannel->Slots[u4Head & (MAILBOX_SLOT_COUNT - 1U)] = *pMessage;
+	dmb(); // message has to be visible before receiver sees the new head
+	pChannel->u4Head = u4Head + 1U;
+
+	// GICSendSoftwareInterrupt completes the head write (dsb) before raising the SGI
+	if(GICSendSoftwareInterrupt(MAILBOX_SGI_ID, (RUINT8)(0x01U << u4TargetCpu)) != GIC_SUCCESS)
+	{
+		return MAILBOX_FAILURE;
+	}
+
+	return MAILBOX_SUCCESS;
+}
+
+/*
+ * takes the oldest message sent to the calling core, returns MAILBOX_EMPTY if there is none.
+ * only one context per core may receive.
+ */
+MailboxResultType MailboxReceive(MailboxMessageType *pMessage)
+{
+	MailboxChannelType *pChannel;
+	RUINT32 u4Tail;
+
+	if(pMessage == NULL)
+	{
+		return MAILBOX_FAILURE;
+	}
+
+	pChannel = &sMailbox.Channels[MailboxGetCpuId()];
+	u4Tail = pChannel->u4Tail;
+	if(pChannel->u4Head == u4Tail)
+	{
+		return MAILBOX_EMPTY;
+	}
+
+	dmb(); // read head before reading the message it covers
+	*pMessage = pChannel->Slots[u4Tail & (MAILBOX_SLOT_COUNT - 1U)];
+	dmb(); // message is copied before the slot is given back to sender
+	pChannel->u4Tail = u4Tail + 1U;
+
+	return MAILBOX_SUCCESS;
+}
@@ -0,0 +1,36 @@
+/*
+ * Mailbox.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_MAILBOX_H_
+#define SRC_MAILBOX_H_
+/**************Inclusions******************/
+#include "CommonTypes.h"
+/**************Macros******************/
+#define MAILBOX_NUMBER_OF_CPUS 2U
+#define MAILBOX_SLOT_COUNT 16U // messages per direction, must be power of two
+#define MAILBOX_MESSAGE_WORDS 7U // payload words, a message is 32 bytes - one cache line
+#define MAILBOX_SGI_ID 0U // software generated interrupt that signals a new message
+
+/**************Definitions******************/
+typedef struct {
+	RUINT32 u4Type; // user defined message type
+	RUINT32 au4Data[MAILBOX_MESSAGE_WORDS];
+} MailboxMessageType;
+
+typedef enum {
+	MAILBOX_SUCCESS = 0,
+	MAILBOX_FAILURE = 1, // invalid parameter
+	MAILBOX_FULL, // receiver did not consume earlier messages yet
+	MAILBOX_EMPTY
+} MailboxResultType;
+
+/**************Prototypes******************/
+MailboxResultType MailboxInitialize(RUINT32 u4ResetChannels);
+MailboxResultType MailboxSend(RUINT32 u4TargetCpu, const MailboxMessageType *pMessage);
+MailboxResultType MailboxReceive(MailboxMessageType *pMessage);
+RUINT32 MailboxGetCpuId(void);
+
+#endif /* SRC_MAILBOX_H_ */
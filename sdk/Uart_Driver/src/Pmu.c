@@ -0,0 +1,28 @@
+/*
+ * Pmu.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * Cortex-A9 PMU cycle counter shared by the UART statistics, GIC profiling and the benchmarks.
+ * xpm_counter.c only drives the six event counters, cycle counter is enabled here with the same CP15 accessors
+ */
+
+/**************Includes******************/
+#include "Pmu.h"
+
+/*
+ * starts the cycle counter (PMCCNTR) counting every CPU cycle. other counters and their state are kept,
+ * calling it again does not reset the count
+ */
+void PmuEnableCycleCounter(void)
+{
+	RUINT32 u4Pmcr = mfcp(XREG_CP15_PERF_MONITOR_CTRL);
+
+	u4Pmcr |= ((RUINT32)0x01 << PMCR_ENABLE);
+	u4Pmcr &= ~((RUINT32)0x01 << PMCR_CYCLE_DIV64);
+	mtcp(XREG_CP15_PERF_MONITOR_CTRL, u4Pmcr);
+	mtcp(XREG_CP15_COUNT_ENABLE_SET, ((RUINT32)0x01 << PMCNTEN_CYCLE));
+}
@@ -0,0 +1,27 @@
+/*
+ * Pmu.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_PMU_H_
+#define SRC_PMU_H_
+/**************Inclusions******************/
+#include "CommonTypes.h"
+#include "xpseudo_asm.h"
+/**************Macros******************/
+/*Performance monitor control register bits - Cortex-A9 TRM 11.4*/
+#define PMCR_ENABLE 0 // E : enable all counters
+#define PMCR_CYCLE_DIV64 3 // D : cycle counter counts every 64th cycle
+#define PMCNTEN_CYCLE 31 // cycle counter bit of count enable set register
+
+/**************Prototypes******************/
+void PmuEnableCycleCounter(void);
+
+/*CPU cycles counted by PMCCNTR since PmuEnableCycleCounter, wraps after 2^32 cycles*/
+static inline RUINT32 PmuReadCycleCounter(void)
+{
+	return (RUINT32)mfcp(XREG_CP15_PERF_CYCLE_COUNTER);
+}
+
+#endif /* SRC_PMU_H_ */
@@ -34,12 +34,28 @@
  * user makefile.
  */
 #include <stdio.h>
+#include <string.h>
 #include "platform.h"
 #include "Uart.h"
 #include "xil_io.h"
+#include "sleep.h"
+#include "xpseudo_asm.h"
 #include "CommonTypes.h"
+#include "GIC.h"
+#include "Pmu.h"
+#include "xil_printf.h"
+#include "xparameters.h"
 
 /**************Preprocessor******************/
+/*
+ * buffered stdout of the BSP (STDOUT_BUFFERED, outbyte.c) owns the STDOUT uart : XStdout_InterruptHandler refills
+ * its TX fifo on TX empty, this driver acks every ISR bit and turns TX empty on and off. they can not share a
+ * controller, InitializeUartMulti refuses the STDOUT uart in buffered builds.
+ */
+#if STDOUT_BUFFERED && !defined(STDOUT_BASEADDRESS)
+#error "STDOUT_BUFFERED needs STDOUT_BASEADDRESS from xparameters.h"
+#endif
+
 /*System level control registers - SLCR base address*/
 #define SLCR_BASE_ADDR 0xF8000000
 #define UART_RST_CTRL_OFFSET 0x00000228
@@ -48,6 +64,25 @@
 #define MIO_PIN_48_OFFSET 0x000007C0
 #define MIO_PIN_49_OFFSET 0x000007C4
 #define UART_CLK_CONTROL_OFFSET 0x00000154
+#define ARM_PLL_CTRL_OFFSET 0x00000100
+#define DDR_PLL_CTRL_OFFSET 0x00000104
+#define IO_PLL_CTRL_OFFSET 0x00000108
+
+/*PLL and UART reference clock fields - UG585 appendix B.28*/
+#define PS_CLK_FREQ_HZ 33333333U // PS_CLK input of the board
+#define PLL_FDIV_SHIFT 12
+#define PLL_FDIV_MASK 0x7FU
+#define PLL_BYPASS_FORCE 4
+#define UART_CLK_DIVISOR_SHIFT 8
+#define UART_CLK_DIVISOR_MASK 0x3FU
+#define UART_CLK_SRCSEL_SHIFT 4
+#define UART_CLK_SRCSEL_MASK 0x3U
+
+/*baud rate generator limits*/
+#define UART_CD_MIN 1U
+#define UART_CD_MAX 65535U
+#define UART_BDIV_MIN 4U
+#define UART_BDIV_MAX 255U
 
 /*Interrupt Enable/Disable registers bit offsets*/
 #define TOVR 12
@@ -67,6 +102,8 @@
 /*UART Controller base addresses*/
 #define XUARTPS_BASE_ADDR 0xE0000000 // UART devices base addresses without device specification
 #define UARTPS_DEVICE_ADDR_CONST 0x1000 // uart device address specification address
+#define UART_REG_ADDR(offset, Instance) ((offset) + sUartContext[(Instance)->DeviceNum].u4BaseAddr)
+#define UART_RESET_HOLD_US 10000U // reset pulse length, shared by all controllers reset together
 
 /*Register Address definitions*/
 #define XUARTPS_CR_OFFSET 0x00000000
@@ -82,6 +119,8 @@
 #define XUARTPS_SR_OFFSET 0x0000002C // Channel status register offset
 #define XUARTPS_FIFO_OFFSET 0x00000030 // UART TX/RX FIFO
 #define XUARTPS_RXWM_OFFSET 0x00000020 // UART RX FIFO trigger level register
+#define XUARTPS_MODEMCR_OFFSET 0x00000024 // modem control register
+#define XUARTPS_FLOWDEL_OFFSET 0x00000038 // RX fifo level that deasserts RTS in automatic flow control
 
 //TODO do the rest
 /*Control register bits positions*/
@@ -101,6 +140,12 @@
 #define MR_PAR 0b100 << 5
 #define MR_CHRL 0b00 << 2
 #define MR_CLKSEL 0b0 << 0
+#define XUARTPS_MR_CLKSEL 0 // bit position - uart_ref_clk / 8 is used as sel_clk
+
+/*Modem control register bits*/
+#define XUARTPS_MODEMCR_FCM 5 // automatic flow control mode - RTS driven by FLOWDEL, TX gated by CTS
+#define XUARTPS_MODEMCR_RTS 1
+#define XUARTPS_MODEMCR_DTR 0
 
 /*Channel Status register bits*/
 #define XUARTPS_SR_TNFUL 14
@@ -116,31 +161,83 @@
 #define XUARTPS_SR_RXOVR 0 // indicate RX FIFO trigger
 /********************************************************************************/
 
+/*traffic statistics helpers, pContext must not be NULL. expand to nothing if statistics are compiled out*/
+#if UART_STATS_ENABLE
+#define UART_STATS_INC(pContext, Field) ((pContext)->Stats.Field++)
+#define UART_STATS_ADD(pContext, Field, Value) ((pContext)->Stats.Field += (Value))
+#define UART_STATS_MAX(pContext, Field, Value) \
+	do { if((Value) > (pContext)->Stats.Field) { (pContext)->Stats.Field = (Value); } } while(0)
+#else
+#define UART_STATS_INC(pContext, Field) do { } while(0)
+#define UART_STATS_ADD(pContext, Field, Value) do { (void)(Value); } while(0)
+#define UART_STATS_MAX(pContext, Field, Value) do { (void)(Value); } while(0)
+#endif
+
 #define UARTPS_MR_DEFAULT (MR_CHMOD | MR_NBSTOP | \
 						   MR_PAR | MR_CHRL | MR_CLKSEL)
 /**************Definitions******************/
-static uartCfgType sCfgInstance_Device0; // to be set by ConfigureUart Function
-static uartCfgType sCfgInstance_Device1; // to be set by ConfigureUart Function
+/*
+ * single producer / single consumer byte ring.
+ * head and tail are free running indexes, buffer index is (index & u4Mask).
+ * producer only writes u4Head, consumer only writes u4Tail thus no lock is needed
+ * between application context and interrupt context.
+ */
+typedef struct {
+	RUINT8 *pu1Buffer;
+	RUINT32 u4Mask;
+	volatile RUINT32 u4Head;
+	volatile RUINT32 u4Tail;
+} uartRingType;
+
+/*driver internal run time data of each uart controller*/
+typedef struct {
+	RUINT32 u4BaseAddr; // controller register base address
+	uartCfgType Cfg; // to be set by initializeUartCfg Function
+	uartRingType TxRing; // filled by UartSendDataNonBlocking, drained by TX empty interrupt
+	uartRingType RxRing; // filled by receive interrupt, drained by UartRead / UartRxPeek
+	uartBaudDivisorType BaudDivisor; // baud rate generator setting in use
+	uartStatsType Stats; // run time counters, read by UartGetStats
+	uartRxCallbackType RxCallback; // run as deferred work when new data is in RX ring
+	void *pRxCallbackArgument;
+	volatile RUINT32 u4RxWorkPending; // RX deferred work is queued and not started yet
+} uartDeviceContextType;
+
+/*all run time state of a controller lives here, each instance can be used independently*/
+static uartDeviceContextType sUartContext[UART_NUMBER_OF_INSTANCES] = {
+	{ .u4BaseAddr = XUARTPS_BASE_ADDR },
+	{ .u4BaseAddr = XUARTPS_BASE_ADDR + UARTPS_DEVICE_ADDR_CONST },
+};
+static RUINT8 a1UartTxRingBuffer[UART_NUMBER_OF_INSTANCES][UART_TX_RING_SIZE];
+static RUINT8 a1UartRxRingBuffer[UART_NUMBER_OF_INSTANCES][UART_RX_RING_SIZE];
 
 /**************Function Prototypes******************/
 static void uartRegWrite(RUINT32 addr, RUINT32 value, uartCfgType *Instance);
 static void uartRegRead(RUINT32 addr, RUINT32 *value, uartCfgType *Instance);
-static void uartReset(uartCfgType *Instance);
+static void uartReset(RUINT32 u4DeviceMask);
 static void regWrite(RUINT32 addr, RUINT32 value);
 static void regRead(RUINT32 addr, RUINT32 *value);
-ReturnType InitializeUartCfg(uartCfgType *cfgInstance);
+static ReturnType uartConfigureController(uartCfgType *pCfgInstance);
 static ReturnType TxDataPolling(RUINT8 *pu1Data, RUINT32 u4Size, uartCfgType *pCfgInstance);
 static ReturnType RxDataPolling(RUINT8 *pu1Data, RUINT32 u4Size, uartCfgType *pCfgInstance);
 static ReturnType isTxFifoEmpty(uartCfgType *pCfgInstance);
+static ReturnType isTxFifoFull(uartCfgType *pCfgInstance);
+static RUINT32 txFifoFill(const RUINT8 *pu1Data, RUINT32 u4Size, uartCfgType *pCfgInstance);
 static ReturnType isRxFifoFull(uartCfgType *pCfgInstance);
 //what this control register does is that - set bits of this register and then write this data to spesific register - instance config
 static ReturnType uartTx(RUINT32 *TxBuffer, RUINT32 size);
 static ReturnType uartRx(RUINT32 *RxBuffer, RUINT32 size);
 static ReturnType enableInterrupt(uartCfgType *pCfgInstance);
+static RUINT32 uartGetRxTriggerLevel(uartCfgType *pCfgInstance);
+static RUINT32 uartGetRxTimeout(uartCfgType *pCfgInstance);
+static ReturnType configureFlowControl(uartCfgType *pCfgInstance);
+static uartDeviceContextType* uartGetContext(uartCfgType *pCfgInstance);
+static void ringInit(uartRingType *pRing, RUINT8 *pu1Buffer, RUINT32 u4Size);
+static RUINT32 ringPut(uartRingType *pRing, const RUINT8 *pu1Data, RUINT32 u4Size);
+static void uartTxRefill(uartCfgType *pCfgInstance);
+static RUINT32 uartRxDrain(uartCfgType *pCfgInstance);
+static void uartRxDeferredWork(void *pArgument);
 
 
-RUINT8 a1UartRxArray[1000];
-
 /*
  * @param :
  * @ addr : address of the register that the value will be written
@@ -150,8 +247,12 @@ RUINT8 a1UartRxArray[1000];
  */
 static void regWrite (RUINT32 addr, RUINT32 value)
 {
+#if UART_HOST_MODEL
+	UartHostModelWrite(addr, value);
+#else
 	RUINT32 *tempAddr = (RUINT32 *)(addr) ; // typecast addr val to pointer
 	*tempAddr = value; // set data pointed by tempAddr to input value
+#endif
 	return;
 }
 
@@ -165,8 +266,12 @@ static void regWrite (RUINT32 addr, RUINT32 value)
  */
 static void regRead(RUINT32 addr, RUINT32 *value)
 {
+#if UART_HOST_MODEL
+	*value = UartHostModelRead(addr);
+#else
 	RUINT32 *tempAddr = (RUINT32 *)(addr); // typecast addr val to pointer
 	*value = *tempAddr; // read data and set to pointed by value
+#endif
 	return;
 }
 
@@ -180,9 +285,13 @@ static void regRead(RUINT32 addr, RUINT32 *value)
 static void uartRegWrite (RUINT32 addr, RUINT32 value, uartCfgType *Instance)
 {
 
+#if UART_HOST_MODEL
+	UartHostModelWrite(UART_REG_ADDR(addr, Instance), value);
+#else
 	// typecast addr val to pointer
-	volatile RUINT32 *tempAddr = (volatile RUINT32 *)(addr + XUARTPS_BASE_ADDR + (UARTPS_DEVICE_ADDR_CONST * Instance->DeviceNum));
+	volatile RUINT32 *tempAddr = (volatile RUINT32 *)UART_REG_ADDR(addr, Instance);
 	*tempAddr = value; // set data pointed by tempAddr to input value
+#endif
 	return;
 }
 
@@ -195,8 +304,12 @@ static void uartRegWrite (RUINT32 addr, RUINT32 value, uartCfgType *Instance)
  */
 static void uartRegRead(RUINT32 addr, RUINT32 *value, uartCfgType *Instance)
 {
-	RUINT32 *tempAddr = (RUINT32 *)(addr + XUARTPS_BASE_ADDR + (UARTPS_DEVICE_ADDR_CONST * Instance->DeviceNum)); // typecast addr val to pointer
+#if UART_HOST_MODEL
+	*value = UartHostModelRead(UART_REG_ADDR(addr, Instance));
+#else
+	volatile RUINT32 *tempAddr = (volatile RUINT32 *)UART_REG_ADDR(addr, Instance); // typecast addr val to pointer
 	*value = *tempAddr; // read data and set to pointed by value
+#endif
 	return;
 }
 
@@ -205,12 +318,21 @@ static void uartRegRead(RUINT32 addr, RUINT32 *value, uartCfgType *Instance)
  */
 static void uartSetRegBit (RUINT32 u4RegAddr, RUINT8 u1BitPos, uartCfgType *Instance)
 {
-	RUINT32 *pu4TempReg = (RUINT32 *)(u4RegAddr + XUARTPS_BASE_ADDR + (UARTPS_DEVICE_ADDR_CONST * Instance->DeviceNum));
+#if UART_HOST_MODEL
+	RUINT32 u4RegValue;
+#else
+	volatile RUINT32 *pu4TempReg = (volatile RUINT32 *)UART_REG_ADDR(u4RegAddr, Instance);
+#endif
 	RUINT32 u4TempValue = ((RUINT32)0x01U << u1BitPos);
 	if(u1BitPos < 32)
 	{
 		// sets specific bit to 1
+#if UART_HOST_MODEL
+		uartRegRead(u4RegAddr, &u4RegValue, Instance);
+		uartRegWrite(u4RegAddr, u4RegValue | u4TempValue, Instance);
+#else
 		*pu4TempReg |= u4TempValue;
+#endif
 	}
 }
 
@@ -219,34 +341,92 @@ static void uartSetRegBit (RUINT32 u4RegAddr, RUINT8 u1BitPos, uartCfgType *Inst
  */
 static void uartClearRegBit (RUINT32 u4RegAddr, RUINT8 u1BitPos, uartCfgType *Instance)
 {
-	RUINT32 *pu4TempReg = (RUINT32 *)(u4RegAddr + XUARTPS_BASE_ADDR + (UARTPS_DEVICE_ADDR_CONST * Instance->DeviceNum));
+#if UART_HOST_MODEL
+	RUINT32 u4RegValue;
+#else
+	volatile RUINT32 *pu4TempReg = (volatile RUINT32 *)UART_REG_ADDR(u4RegAddr, Instance);
+#endif
 	RUINT32 u4TempValue = ((RUINT32)0x1 << u1BitPos);
 	u4TempValue = ~u4TempValue;
 	if(u1BitPos < 32)
 	{
 		// sets specific bit to 1
+#if UART_HOST_MODEL
+		uartRegRead(u4RegAddr, &u4RegValue, Instance);
+		uartRegWrite(u4RegAddr, u4RegValue & u4TempValue, Instance);
+#else
 		*pu4TempReg &= u4TempValue;
+#endif
 	}
 }
 
-static void uartReset (uartCfgType *Instance)
+/*
+ * returns driver run time context of the instance, NULL if instance is not valid
+ */
+static uartDeviceContextType* uartGetContext(uartCfgType *pCfgInstance)
+{
+	if((pCfgInstance == NULL) || ((RUINT32)pCfgInstance->DeviceNum >= UART_NUMBER_OF_INSTANCES))
+	{
+		return NULL;
+	}
+	return &sUartContext[pCfgInstance->DeviceNum];
+}
+
+/*
+ * u4Size must be power of two
+ */
+static void ringInit(uartRingType *pRing, RUINT8 *pu1Buffer, RUINT32 u4Size)
+{
+	pRing->pu1Buffer = pu1Buffer;
+	pRing->u4Mask = u4Size - 1U;
+	pRing->u4Head = 0U;
+	pRing->u4Tail = 0U;
+}
+
+/*
+ * producer side of the ring : copies as many bytes as there is space for and
+ * returns number of bytes queued. Must only be called from one context.
+ */
+static RUINT32 ringPut(uartRingType *pRing, const RUINT8 *pu1Data, RUINT32 u4Size)
+{
+	RUINT32 u4Head = pRing->u4Head;
+	RUINT32 u4Free = (pRing->u4Mask + 1U) - (u4Head - pRing->u4Tail);
+	RUINT32 u4Index;
+
+	if(u4Size > u4Free)
+	{
+		u4Size = u4Free;
+	}
+
+	for(u4Index = 0; u4Index < u4Size; u4Index++)
+	{
+		pRing->pu1Buffer[(u4Head + u4Index) & pRing->u4Mask] = pu1Data[u4Index];
+	}
+
+	dmb(); // data has to be visible before consumer sees the new head
+	pRing->u4Head = u4Head + u4Size;
+
+	return u4Size;
+}
+
+/*
+ * resets controllers in u4DeviceMask (bit 0 : uart 0, bit 1 : uart 1) together,
+ * so bringing up both controllers waits for one reset pulse only
+ */
+static void uartReset (RUINT32 u4DeviceMask)
 {
 
 	RUINT32 UART_reset_addr = SLCR_BASE_ADDR + UART_RST_CTRL_OFFSET;
-	RUINT32 UART_reset_val = 1U;
-	RUINT32 UART_base_shifter = 2;
+	RUINT32 UART_base_shifter = 2; // UART0_REF_RST - UART1_REF_RST bits
 	RUINT32 u4TempValue = 0;
-	RUINT32 u4Mask = 0x01;
-	UART_reset_val = UART_reset_val << (UART_base_shifter + Instance->DeviceNum);
+	RUINT32 u4Mask = (u4DeviceMask & 0x03U) << UART_base_shifter;
 
-	regWrite(UART_reset_addr, UART_reset_val); // assert reset
-	usleep(10000); // wait for 10ms
 	regRead(UART_reset_addr, &u4TempValue);
-	u4Mask = u4Mask << (UART_base_shifter + Instance->DeviceNum);
-	u4Mask = ~u4Mask;
-	u4TempValue &= u4Mask;
+	regWrite(UART_reset_addr, u4TempValue | u4Mask); // assert reset
+	usleep(UART_RESET_HOLD_US);
+	regRead(UART_reset_addr, &u4TempValue);
+	u4TempValue &= ~u4Mask;
 	regWrite(UART_reset_addr, u4TempValue); // deassert reset to disable write protection
-	// safe version regWrite(UART_reset_addr, 0x00);
 }
 
 /*
@@ -259,20 +439,16 @@ static void uartReset (uartCfgType *Instance)
 
 ReturnType initializeUartCfg (uartCfgType *cfgInstance)
 {
-	ReturnType retVal = XST_FAILURE;
-	if(cfgInstance->DeviceNum == UART_INSTANCE_DEVICE_0)
-	{
-		sCfgInstance_Device0 = *cfgInstance;
-		retVal = XST_SUCCESS;
-	}
-	else if(cfgInstance->DeviceNum == UART_INSTANCE_DEVICE_1)
+	uartDeviceContextType *pContext = uartGetContext(cfgInstance);
+
+	if(pContext == NULL)
 	{
-		sCfgInstance_Device1 = *cfgInstance;
-		retVal = XST_SUCCESS;
+		return XST_FAILURE;
 	}
 
-	return retVal;
-	/* input config is connected to static driver config so that changing from outside of driver will affect statically*/
+	pContext->Cfg = *cfgInstance;
+	return XST_SUCCESS;
+	/* input config is copied to driver config, changing the input afterwards does not affect the driver*/
 }
 
 static void setIORouting(uartCfgType *cfgInstance)
@@ -307,14 +483,97 @@ static void configureUartClock(uartCfgType *cfgInstance)
 {
 	RUINT32 u4TempVal = 1U;
 	u4TempVal = u4TempVal << cfgInstance->DeviceNum ;
-	RUINT32 uartClksetDefault = 0x00001400U; // uart 0 disabled - uart 0 enabled
-	uartClksetDefault |= u4TempVal;
+	RUINT32 uartClksetDefault = 0x00001400U; // IO PLL / 20
 	RUINT32 clkCtrlAddr = SLCR_BASE_ADDR + UART_CLK_CONTROL_OFFSET;
+	RUINT32 u4ReadClkCtrl;
+
+	// keep clock active bit of the other controller, reference clock is shared by both
+	regRead(clkCtrlAddr, &u4ReadClkCtrl);
+	u4ReadClkCtrl &= ~((UART_CLK_DIVISOR_MASK << UART_CLK_DIVISOR_SHIFT) | (UART_CLK_SRCSEL_MASK << UART_CLK_SRCSEL_SHIFT));
+	uartClksetDefault |= u4ReadClkCtrl | u4TempVal;
 
 	// configure UART reference clock
 	regWrite(clkCtrlAddr, uartClksetDefault); // 50 MHz clock for the UART  - UG585 : p598
 }
 
+/*
+ * RX trigger level in use : 0 selects the default, levels the fifo can not reach are clamped
+ */
+static RUINT32 uartGetRxTriggerLevel(uartCfgType *pCfgInstance)
+{
+	RUINT32 u4TriggerLevel = (RUINT32)pCfgInstance->u1RxTriggerLevel;
+
+	if(u4TriggerLevel == 0U)
+	{
+		u4TriggerLevel = UART_DEFAULT_RX_TRIGGER_LEVEL;
+	}
+	else if(u4TriggerLevel >= UART_RX_FIFO_DEPTH)
+	{
+		u4TriggerLevel = UART_RX_FIFO_DEPTH - 1U;
+	}
+
+	return u4TriggerLevel;
+}
+
+/*
+ * RXTOUT register value : 0 selects the default, UART_RX_TIMEOUT_DISABLED gives 0 which keeps the timeout off
+ */
+static RUINT32 uartGetRxTimeout(uartCfgType *pCfgInstance)
+{
+	RUINT32 u4Timeout = (RUINT32)pCfgInstance->u1RxTimeout;
+
+	if(u4Timeout == 0U)
+	{
+		u4Timeout = UART_DEFAULT_RX_TIMEOUT;
+	}
+	else if(u4Timeout == UART_RX_TIMEOUT_DISABLED)
+	{
+		u4Timeout = 0U;
+	}
+
+	return u4Timeout;
+}
+
+/*
+ * automatic RTS / CTS flow control : controller deasserts RTS once RX fifo holds FLOWDEL bytes
+ * and stops transmitting while CTS is deasserted, no software is involved at any baud rate.
+ * FLOWDEL has to be above RX trigger level, otherwise sender is held off before the receive
+ * interrupt fires and the link only moves on receiver timeouts.
+ */
+static ReturnType configureFlowControl(uartCfgType *pCfgInstance)
+{
+	RUINT32 u4FlowDelay = (RUINT32)pCfgInstance->u1FlowDelay;
+	RUINT32 u4ModemCtrl = ((RUINT32)0x01 << XUARTPS_MODEMCR_RTS) | ((RUINT32)0x01 << XUARTPS_MODEMCR_DTR);
+
+	if(pCfgInstance->FlowControl == UART_FLOW_CONTROL_NONE)
+	{
+		// RTS and DTR are kept asserted, flow delay disabled
+		uartRegWrite(XUARTPS_FLOWDEL_OFFSET, 0U, pCfgInstance);
+		uartRegWrite(XUARTPS_MODEMCR_OFFSET, u4ModemCtrl, pCfgInstance);
+		return XST_SUCCESS;
+	}
+
+	if(pCfgInstance->FlowControl != UART_FLOW_CONTROL_RTS_CTS)
+	{
+		return XST_FAILURE;
+	}
+
+	if(u4FlowDelay == 0U)
+	{
+		u4FlowDelay = UART_DEFAULT_FLOW_DELAY;
+	}
+	if((u4FlowDelay < UART_FLOW_DELAY_MIN) || (u4FlowDelay >= UART_RX_FIFO_DEPTH) ||
+			(u4FlowDelay <= uartGetRxTriggerLevel(pCfgInstance)))
+	{
+		return XST_FAILURE;
+	}
+
+	uartRegWrite(XUARTPS_FLOWDEL_OFFSET, u4FlowDelay, pCfgInstance);
+	uartRegWrite(XUARTPS_MODEMCR_OFFSET, u4ModemCtrl | ((RUINT32)0x01 << XUARTPS_MODEMCR_FCM), pCfgInstance);
+
+	return XST_SUCCESS;
+}
+
 static void configuraUartCtrlReg(uartCfgType *cfgInstance)
 {
 	RUINT32 ModeRegAddr = XUARTPS_MR_OFFSET;
@@ -326,6 +585,135 @@ static void configuraUartCtrlReg(uartCfgType *cfgInstance)
 
 }
 
+/*
+ * Finds CD, BDIV and MR_CLKSEL values giving the closest baud rate to u4BaudRate
+ * for reference clock u4RefClkHz. baud = sel_clk / (CD * (BDIV + 1)).
+ * Only depends on its inputs so it can be run on host as well.
+ * returns XST_FAILURE for invalid input only, rates no divisor comes close to are reported
+ * with their error in u4ErrorPpm - caller decides what is acceptable.
+ */
+ReturnType UartSolveBaudRate(RUINT32 u4RefClkHz, RUINT32 u4BaudRate, uartBaudDivisorType *pDivisor)
+{
+	ReturnType retVal = XST_FAILURE;
+	RUINT32 u4ClkSel;
+	RUINT32 u4SelClk;
+	RUINT32 u4Bdiv;
+	RUINT32 u4Cd;
+	RUINT32 u4CdLow;
+	RUINT32 u4Actual;
+	RUINT32 u4Diff;
+	RUINT32 u4BestDiff = 0xFFFFFFFFU;
+
+	if((pDivisor == NULL) || (u4BaudRate == 0U) || (u4RefClkHz == 0U))
+	{
+		return XST_FAILURE;
+	}
+
+	for(u4ClkSel = 0U; u4ClkSel < 2U; u4ClkSel++)
+	{
+		u4SelClk = (u4ClkSel == 0U) ? u4RefClkHz : (u4RefClkHz / 8U);
+
+		for(u4Bdiv = UART_BDIV_MIN; u4Bdiv <= UART_BDIV_MAX; u4Bdiv++)
+		{
+			// rate falls as CD grows, closest one is at the CD just below or just above the exact quotient.
+			// rounding the quotient is not enough, rate is 1 / CD
+			u4CdLow = (u4SelClk / (u4Bdiv + 1U)) / u4BaudRate;
+			for(u4Cd = u4CdLow; u4Cd <= (u4CdLow + 1U); u4Cd++)
+			{
+				if((u4Cd < UART_CD_MIN) || (u4Cd > UART_CD_MAX))
+				{
+					continue;
+				}
+
+				u4Actual = u4SelClk / (u4Cd * (u4Bdiv + 1U));
+				u4Diff = (u4Actual > u4BaudRate) ? (u4Actual - u4BaudRate) : (u4BaudRate - u4Actual);
+				if(u4Diff < u4BestDiff)
+				{
+					u4BestDiff = u4Diff;
+					pDivisor->u4Cd = u4Cd;
+					pDivisor->u4Bdiv = u4Bdiv;
+					pDivisor->u4ClkSelDiv8 = u4ClkSel;
+					pDivisor->u4ActualBaudRate = u4Actual;
+					retVal = XST_SUCCESS;
+				}
+			}
+			if(u4CdLow == 0U)
+			{
+				break; // rate is above sel_clk / (BDIV + 1) even with CD = 1, larger BDIV only moves further away
+			}
+		}
+	}
+
+	if(retVal == XST_SUCCESS)
+	{
+		pDivisor->u4ErrorPpm = (RUINT32)(((RDouble)u4BestDiff * 1000000.0) / (RDouble)u4BaudRate);
+	}
+
+	return retVal;
+}
+
+/*
+ * returns uart_ref_clk frequency from UART_CLK_CTRL and the selected PLL settings in SLCR
+ */
+RUINT32 UartGetRefClockHz(void)
+{
+	RUINT32 u4ClkCtrl;
+	RUINT32 u4PllCtrl;
+	RUINT32 u4PllOffset;
+	RUINT32 u4PllHz;
+	RUINT32 u4Divisor;
+
+	regRead(SLCR_BASE_ADDR + UART_CLK_CONTROL_OFFSET, &u4ClkCtrl);
+
+	switch((u4ClkCtrl >> UART_CLK_SRCSEL_SHIFT) & UART_CLK_SRCSEL_MASK)
+	{
+	case 2U:
+		u4PllOffset = ARM_PLL_CTRL_OFFSET;
+		break;
+	case 3U:
+		u4PllOffset = DDR_PLL_CTRL_OFFSET;
+		break;
+	default:
+		u4PllOffset = IO_PLL_CTRL_OFFSET; // 0x source select
+		break;
+	}
+
+	regRead(SLCR_BASE_ADDR + u4PllOffset, &u4PllCtrl);
+	if((u4PllCtrl & ((RUINT32)0x01 << PLL_BYPASS_FORCE)) != 0U)
+	{
+		u4PllHz = PS_CLK_FREQ_HZ;
+	}
+	else
+	{
+		// PLL output is limited to 2 GHz, fits into 32 bit
+		u4PllHz = PS_CLK_FREQ_HZ * ((u4PllCtrl >> PLL_FDIV_SHIFT) & PLL_FDIV_MASK);
+	}
+
+	u4Divisor = (u4ClkCtrl >> UART_CLK_DIVISOR_SHIFT) & UART_CLK_DIVISOR_MASK;
+	if(u4Divisor == 0U)
+	{
+		return 0U;
+	}
+
+	return u4PllHz / u4Divisor;
+}
+
+/*
+ * copies baud rate generator setting in use, including actual rate and error, to pDivisor
+ */
+ReturnType UartGetBaudRateInfo(uartCfgType *pCfgInstance, uartBaudDivisorType *pDivisor)
+{
+	uartDeviceContextType *pContext = uartGetContext(pCfgInstance);
+
+	if((pContext == NULL) || (pDivisor == NULL))
+	{
+		return XST_FAILURE;
+	}
+
+	*pDivisor = pContext->BaudDivisor;
+	return XST_SUCCESS;
+}
+
 static void RxTxPathControl(uartCfgType *pCfgInstance, uartStatusType option)
 {
 	RUINT32 u4ReadCtrlReg;
@@ -376,108 +764,168 @@ static void RxTxPathControl(uartCfgType *pCfgInstance, uartStatusType option)
 }
 
 
-ReturnType InitializeUart(uartCfgType *pCfgInstance)
+/*
+ * brings up one controller, reset is already released.
+ * pCfgInstance is the driver copy of the configuration
+ */
+static ReturnType uartConfigureController(uartCfgType *pCfgInstance)
 {
-	/*
-	 * procedure :
-	 *		1 - reset controller from SLCR register. there is a spesific uart_reset_ctrl register in SLCR register
-	 *		2 - configure I/O signal routing : can be routed either MIO or EMIO (multiplexed IO or extended Multiplexed IO)
-	 *		from UG585 19.5.1 : MIO programming -> basically from SLCR register (system level control register - the register that
-	 *		controls general specifications of zynq architecture - controls group of modules or operations between modules.
-	 *		General structure is that module registers are for controlling modules within zynq. SLCR is to configure and control system
-	 *		instead of modules which are sub systems of zynq system)
-	 *		3 - Configure UART reference clock : from UG585 19.4.1 clocks
-	 *		4 - Configure controller functions : set uart controller register
-	 *		5 - Configure Interrupts for interrupt driven comm - can be neglected in case of polling.
-	 *			5.1 - Configure modem control - polling and interrupt driven comm.
-	 *		6 - Now ready to manage communications - transver and receive message via shift register, Tx , Rx registers and
-	 *			control registers spesific flags regarding communications
-	 *
-	 */
-
-	// TODO : this sets to 115200, make it configurable
-
 	RUINT32 u4ReadCtrlReg;
 	RUINT32 u4TempValue;
-	RUINT32 u4TrialVal;
-	RUINT32 CD_115200 = (RUINT32)62U;
-	RUINT32 BIDV_115200 = (RUINT32)6U;
-	RUINT32 trial;
+	uartBaudDivisorType *pBaudDivisor = &sUartContext[pCfgInstance->DeviceNum].BaudDivisor;
 
-	uartCfgType* pTempCfgInstance;
-
-	if(pCfgInstance->DeviceNum == UART_INSTANCE_DEVICE_1){
-		pTempCfgInstance = &sCfgInstance_Device1;
-	}
-	else if(pCfgInstance->DeviceNum == UART_INSTANCE_DEVICE_0)
+	// set IO routings - UART 1 - MIO48 RX - MIO49 TX
+	setIORouting(pCfgInstance);
+	// configure UART reference clock
+	configureUartClock(pCfgInstance);
+	// find baud rate generator values for requested baud rate from actual reference clock
+	if(UartSolveBaudRate(UartGetRefClockHz(), (RUINT32)pCfgInstance->BaudRate, pBaudDivisor) != XST_SUCCESS)
 	{
-		pTempCfgInstance = &sCfgInstance_Device0;
+		return XST_FAILURE;
 	}
-	else{
-		// failure
+	if(pBaudDivisor->u4ErrorPpm > UART_BAUD_MAX_ERROR_PPM)
+	{
 		return XST_FAILURE;
 	}
-	initializeUartCfg (pTempCfgInstance);
-
-	// read lock slcr register and unlock slcr register
-	// read slcr status register
-	regRead(0xF800000C, &trial); // register was 1 stating that slcr registers are write protected !!!
-	// write lscr write protection unlock register
-	regWrite(0xF8000008, (RUINT32)0xDF0D);
-	// read slcr write protection status register again - expectation : reg to be 0
-	regRead(0xF800000C, &trial); // register is 0 - write protection disabled !!!
-
-	// reset uart controller
-	uartReset(pTempCfgInstance);
-	// set IO routings - UART 1 - MIO48 RX - MIO49 TX
-	setIORouting(pTempCfgInstance);
-	// configure UART reference clock
-	configureUartClock(pTempCfgInstance);
 	/*Configure Uart control register*/
 	//uart character frame - mode register
-	configuraUartCtrlReg(pTempCfgInstance);
+	configuraUartCtrlReg(pCfgInstance);
 
 	//control reg, baud rate reg and baud rate divider reg options for baud rate
 	// write to three registers : control reg, baud_ge_reg, baud_rate_divider_reg
 
-	RxTxPathControl(pTempCfgInstance, UART_DISABLE);
+	RxTxPathControl(pCfgInstance, UART_DISABLE);
 
+	// select uart_ref_clk / 8 as baud rate generator input if solver asked for it
+	if(pBaudDivisor->u4ClkSelDiv8 != 0U)
+	{
+		uartSetRegBit(XUARTPS_MR_OFFSET, XUARTPS_MR_CLKSEL, pCfgInstance);
+	}
 	// write calculated CD value to baud rate generator register - CD bit field
-	uartRegWrite(XUARTPS_BRGR_OFFSET, CD_115200, pTempCfgInstance);
+	uartRegWrite(XUARTPS_BRGR_OFFSET, pBaudDivisor->u4Cd, pCfgInstance);
 	// write BIDV value to baud rate divider register
-	uartRegWrite(XUARTPS_BRDR_OFFSET, BIDV_115200, pTempCfgInstance);
+	uartRegWrite(XUARTPS_BRDR_OFFSET, pBaudDivisor->u4Bdiv, pCfgInstance);
 
 	// Reset TX and RX paths
-	uartRegRead(XUARTPS_CR_OFFSET, &u4ReadCtrlReg, pTempCfgInstance);
+	uartRegRead(XUARTPS_CR_OFFSET, &u4ReadCtrlReg, pCfgInstance);
 	u4TempValue = (RUINT32)u4ReadCtrlReg | ((RUINT32)0x01 << XUARTPS_CR_TXRST) | ((RUINT32)0x01 << XUARTPS_CR_RXRST);
-	uartRegWrite(XUARTPS_CR_OFFSET, u4TempValue, pTempCfgInstance); // reset TX and RX paths
+	uartRegWrite(XUARTPS_CR_OFFSET, u4TempValue, pCfgInstance); // reset TX and RX paths
 
 	RxTxPathControl(pCfgInstance, UART_ENABLE);
 
 	// Reset TX and RX paths
-	uartRegRead(XUARTPS_CR_OFFSET, &u4ReadCtrlReg, pTempCfgInstance);
+	uartRegRead(XUARTPS_CR_OFFSET, &u4ReadCtrlReg, pCfgInstance);
 	u4TempValue = (RUINT32)u4ReadCtrlReg | ((RUINT32)0x01 << XUARTPS_CR_TXRST) | ((RUINT32)0x01 << XUARTPS_CR_RXRST);
-	uartRegWrite(XUARTPS_CR_OFFSET, u4TempValue, pTempCfgInstance); // reset TX and RX paths
+	uartRegWrite(XUARTPS_CR_OFFSET, u4TempValue, pCfgInstance); // reset TX and RX paths
 
 	// set RxFIFO levels - 32
-	uartRegWrite(XUARTPS_RXFIFO_TRIGGER_OFFSET, (RUINT32)0x01, pTempCfgInstance); // was 32 bytes (0x20)
+	uartRegWrite(XUARTPS_RXFIFO_TRIGGER_OFFSET, (RUINT32)0x01, pCfgInstance); // was 32 bytes (0x20)
 
 	//Enable Controller - Write 0x00000117 to control registers - this value coming from datasheet. TODO : make it configurable
-	uartRegWrite(XUARTPS_CR_OFFSET, 0x00000117, pTempCfgInstance); // controller enabled
+	uartRegWrite(XUARTPS_CR_OFFSET, 0x00000117, pCfgInstance); // controller enabled
 
-	// disable program receive timeout mechanism - write 0 to RSTTO bit field
-	uartRegWrite(XUARTPS_RXTOUT_OFFSET, 0x00, pTempCfgInstance); // receiver timeout disabled
+	// program receive timeout mechanism - RSTTO bit field, 0 keeps it disabled
+	uartRegWrite(XUARTPS_RXTOUT_OFFSET, uartGetRxTimeout(pCfgInstance), pCfgInstance);
+	// restart receiver timeout counter so that new value is used
+	uartSetRegBit(XUARTPS_CR_OFFSET, XUARTPS_CR_TORST, pCfgInstance);
+
+	// RTS / CTS handshake, has to be in place before the first byte is received
+	if(configureFlowControl(pCfgInstance) != XST_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
 
 	//READY TO COMMUNICATE !!!
 	// SO FAR THIS IS DIRECT SOAPING. EVERYTHING IS DIRECTLY SET. TODO : MAKE IT CONFUGIRABLE
 
 	// first trial to send data
 	RUINT8 a1TrialArray[] = "bugra.erbas";
-	TxDataPolling(a1TrialArray, sizeof(a1TrialArray), pTempCfgInstance);
+	TxDataPolling(a1TrialArray, sizeof(a1TrialArray), pCfgInstance);
 
-	enableInterrupt(pCfgInstance);
+	return enableInterrupt(pCfgInstance);
+}
 
-	return XST_SUCCESS;
+ReturnType InitializeUartMulti(uartCfgType **ppCfgInstances, RUINT32 u4NumOfInstances)
+{
+	/*
+	 * procedure :
+	 *		1 - reset controllers from SLCR register, all controllers in ppCfgInstances are reset together. there is a spesific uart_reset_ctrl register in SLCR register
+	 *		2 - configure I/O signal routing : can be routed either MIO or EMIO (multiplexed IO or extended Multiplexed IO)
+	 *		from UG585 19.5.1 : MIO programming -> basically from SLCR register (system level control register - the register that
+	 *		controls general specifications of zynq architecture - controls group of modules or operations between modules.
+	 *		General structure is that module registers are for controlling modules within zynq. SLCR is to configure and control system
+	 *		instead of modules which are sub systems of zynq system)
+	 *		3 - Configure UART reference clock : from UG585 19.4.1 clocks
+	 *		4 - Configure controller functions : set uart controller register
+	 *		5 - Configure Interrupts for interrupt driven comm - can be neglected in case of polling.
+	 *			5.1 - Configure modem control - polling and interrupt driven comm.
+	 *		6 - Now ready to manage communications - transver and receive message via shift register, Tx , Rx registers and
+	 *			control registers spesific flags regarding communications
+	 *
+	 */
+
+	RUINT32 trial;
+	RUINT32 u4Index;
+	RUINT32 u4DeviceMask = 0U;
+	uartDeviceContextType *pContext;
+	ReturnType retVal = XST_SUCCESS;
+
+	if(ppCfgInstances == NULL)
+	{
+		return XST_FAILURE;
+	}
+
+	for(u4Index = 0U; u4Index < u4NumOfInstances; u4Index++)
+	{
+		pContext = uartGetContext(ppCfgInstances[u4Index]);
+		if(pContext == NULL)
+		{
+			// failure
+			return XST_FAILURE;
+		}
+#if STDOUT_BUFFERED
+		if(pContext->u4BaseAddr == STDOUT_BASEADDRESS)
+		{
+			// controller belongs to buffered stdout
+			return XST_FAILURE;
+		}
+#endif
+		initializeUartCfg(ppCfgInstances[u4Index]);
+		ringInit(&pContext->TxRing, a1UartTxRingBuffer[ppCfgInstances[u4Index]->DeviceNum], UART_TX_RING_SIZE);
+		ringInit(&pContext->RxRing, a1UartRxRingBuffer[ppCfgInstances[u4Index]->DeviceNum], UART_RX_RING_SIZE);
+		memset(&pContext->Stats, 0, sizeof(uartStatsType));
+		u4DeviceMask |= ((RUINT32)0x01 << ppCfgInstances[u4Index]->DeviceNum);
+	}
+
+	// read lock slcr register and unlock slcr register
+	// read slcr status register
+	regRead(0xF800000C, &trial); // register was 1 stating that slcr registers are write protected !!!
+	// write lscr write protection unlock register
+	regWrite(0xF8000008, (RUINT32)0xDF0D);
+	// read slcr write protection status register again - expectation : reg to be 0
+	regRead(0xF800000C, &trial); // register is 0 - write protection disabled !!!
+
+#if UART_STATS_ENABLE
+	PmuEnableCycleCounter();
+#endif
+
+	// reset uart controllers - one reset pulse for all of them
+	uartReset(u4DeviceMask);
+
+	for(u4Index = 0U; u4Index < u4NumOfInstances; u4Index++)
+	{
+		if(uartConfigureController(&sUartContext[ppCfgInstances[u4Index]->DeviceNum].Cfg) != XST_SUCCESS)
+		{
+			retVal = XST_FAILURE;
+		}
+	}
+
+	return retVal;
+}
+
+ReturnType InitializeUart(uartCfgType *pCfgInstance)
+{
+	return InitializeUartMulti(&pCfgInstance, 1U);
 }
 
 // returns success(0) in case of TX fifo is empty, if not, returns failure (1)
@@ -498,6 +946,50 @@ static ReturnType isTxFifoEmpty(uartCfgType *pCfgInstance)
 	return (ReturnType)u4RetVal;
 }
 
+// returns 1 in case of TX fifo is full, 0 if there is room for at least one byte
+static ReturnType isTxFifoFull(uartCfgType *pCfgInstance)
+{
+	RUINT32 u4RetVal = 0U;
+	RUINT32 u4ReadStatus = 0U;
+	RUINT32 u4FifoFullMask = 0x01 << XUARTPS_SR_TXFULL;
+
+	uartRegRead(XUARTPS_SR_OFFSET, &u4ReadStatus, pCfgInstance);
+	if((u4ReadStatus & u4FifoFullMask) == u4FifoFullMask)
+	{
+		u4RetVal = 1U; // Tx fifo is full
+	}
+
+	return (ReturnType)u4RetVal;
+}
+
+/*
+ * writes bytes to TX fifo as long as it has room and returns number of bytes written.
+ * if fifo is empty, whole fifo depth is written back to back without reading status for each byte.
+ */
+static RUINT32 txFifoFill(const RUINT8 *pu1Data, RUINT32 u4Size, uartCfgType *pCfgInstance)
+{
+	RUINT32 u4Written = 0U;
+
+	if(isTxFifoEmpty(pCfgInstance))
+	{
+		// burst : fifo is known to have UART_TX_FIFO_DEPTH free slots
+		while((u4Written < u4Size) && (u4Written < UART_TX_FIFO_DEPTH))
+		{
+			uartRegWrite(XUARTPS_FIFO_OFFSET, pu1Data[u4Written], pCfgInstance);
+			u4Written++;
+		}
+	}
+
+	// top up while transmitter keeps freeing slots
+	while((u4Written < u4Size) && !isTxFifoFull(pCfgInstance))
+	{
+		uartRegWrite(XUARTPS_FIFO_OFFSET, pu1Data[u4Written], pCfgInstance);
+		u4Written++;
+	}
+
+	return u4Written;
+}
+
 // returns success(0) in case of TX fifo is not empty, if empty returns 1
 static ReturnType isRxFifoEmpty(uartCfgType *pCfgInstance)
 {
@@ -522,25 +1014,28 @@ static ReturnType isRxFifoEmpty(uartCfgType *pCfgInstance)
  */
 static ReturnType TxDataPolling(RUINT8 *pu1Data, RUINT32 u4Size, uartCfgType *pCfgInstance)
 {
-	RUINT8 u1TempValue;
-	RUINT32 u4TempAddr;
 	RUINT32 u4Index = 0;
-
-	u4TempAddr = pu1Data;
-
-	for(; u4Index < u4Size; u4Index++)
+#if UART_STATS_ENABLE
+	uartDeviceContextType *pContext = uartGetContext(pCfgInstance);
+#endif
+
+	/*procedure :
+	 * keep writing to tx fifo while it is not full so that the line is never idle between bytes
+	 * when fifo is full, spin until transmitter frees a slot
+	 * repeat until number of transmissions is done */
+	while(u4Index < u4Size)
 	{
-		u1TempValue = *(RUINT8 *)(u4TempAddr + u4Index);
-		/*procedure :
-		 * wait for tx fifo to be empty (only than new byte can be send)
-		 * fill the tx fifo with data
-		 * write new data if tx fifo is empty until number of transmissions is done */
+		u4Index += txFifoFill(&pu1Data[u4Index], u4Size - u4Index, pCfgInstance);
+	}
 
-		while(!isTxFifoEmpty(pCfgInstance)); // wait for tx fifo to be empty
-		// fill TX fifo with 1 Byte of pu1Data with
-		uartRegWrite(XUARTPS_FIFO_OFFSET, u1TempValue, pCfgInstance);
+#if UART_STATS_ENABLE
+	if(pContext != NULL)
+	{
+		UART_STATS_ADD(pContext, u4TxByteCount, u4Size);
 	}
+#endif
 
+	return XST_SUCCESS;
 }
 
 /*
@@ -550,8 +1045,7 @@ static ReturnType TxDataPolling(RUINT8 *pu1Data, RUINT32 u4Size, uartCfgType *pC
  */
 static ReturnType RxDataPolling(RUINT8 *pu1Data, RUINT32 u4Size, uartCfgType *pCfgInstance)
 {
-	RUINT8* u1TempValue;
-	RUINT32 u4TempAddr;
+	RUINT32 u4TempValue;
 	RUINT32 u4Index = 0;
 
 	/*
@@ -560,18 +1054,15 @@ static ReturnType RxDataPolling(RUINT8 *pu1Data, RUINT32 u4Size, uartCfgType *pC
 	 * repeat until required size is read
 	 * TODO : clear if timeout*/
 
-	u4TempAddr = pu1Data;
-	u1TempValue = (RUINT8 *)(u4TempAddr);
-
 	while(u4Index < u4Size){
 		if(!isRxFifoEmpty(pCfgInstance)){
-			uartRegRead(XUARTPS_FIFO_OFFSET, u1TempValue, pCfgInstance);// read if rx fifo is not empty
+			uartRegRead(XUARTPS_FIFO_OFFSET, &u4TempValue, pCfgInstance);// read if rx fifo is not empty
+			pu1Data[u4Index] = (RUINT8)u4TempValue; // fifo register is 32 bit wide, only its low byte is data
 		}
 		else
 			break;
 
 		u4Index++;
-		u1TempValue = (RUINT8 *)(u4TempAddr + u4Index);
 
 	}
 }
@@ -579,7 +1070,463 @@ static ReturnType RxDataPolling(RUINT8 *pu1Data, RUINT32 u4Size, uartCfgType *pC
 
 ReturnType UartSendData(RUINT8 *pu1Data, uartCfgType *pCfgInstance, RUINT32 Size)
 {
-	TxDataPolling(pu1Data, Size, pCfgInstance);
+	return TxDataPolling(pu1Data, Size, pCfgInstance);
+}
+
+/*
+ * Queues data to the instance TX ring and returns immediately. TX empty interrupt
+ * moves queued data to the TX fifo in bursts of up to UART_TX_FIFO_DEPTH bytes.
+ * returns number of bytes queued, which is less than Size if the ring is full.
+ * Only one context may call this function per instance, do not mix with UartSendData
+ * on the same instance while the ring is not drained.
+ */
+RUINT32 UartSendDataNonBlocking(RUINT8 *pu1Data, uartCfgType *pCfgInstance, RUINT32 Size)
+{
+	uartDeviceContextType *pContext = uartGetContext(pCfgInstance);
+	RUINT32 u4Queued = 0U;
+
+	if((pContext != NULL) && (pu1Data != NULL))
+	{
+		u4Queued = ringPut(&pContext->TxRing, pu1Data, Size);
+		if(u4Queued != 0U)
+		{
+			// TX empty status is already set while the fifo is idle, enabling it fires the interrupt at once
+			uartRegWrite(XUARTPS_IER_OFFSET, ((RUINT32)0x01 << XUARTPS_IXR_TXEMPTY), pCfgInstance);
+		}
+	}
+
+	return u4Queued;
+}
+
+/*
+ * returns number of bytes waiting in the TX ring
+ */
+RUINT32 UartTxPending(uartCfgType *pCfgInstance)
+{
+	uartDeviceContextType *pContext = uartGetContext(pCfgInstance);
+
+	if(pContext == NULL)
+	{
+		return 0U;
+	}
+	return pContext->TxRing.u4Head - pContext->TxRing.u4Tail;
+}
+
+/*
+ * spins until every byte handed to the driver has left the TX line : TX ring empty, TX fifo empty and
+ * transmitter idle. bytes in the ring are sent by the TX interrupt, so it must not be called with IRQs masked
+ * while UartSendDataNonBlocking data is pending.
+ */
+ReturnType UartTxWaitIdle(uartCfgType *pCfgInstance)
+{
+	RUINT32 u4Status = 0U;
+	const RUINT32 u4IdleMask = ((RUINT32)0x01 << XUARTPS_SR_TXEMPTY) | ((RUINT32)0x01 << XUARTPS_SR_TACTIVE);
+
+	if(uartGetContext(pCfgInstance) == NULL)
+	{
+		return XST_FAILURE;
+	}
+
+	while(UartTxPending(pCfgInstance) != 0U)
+	{
+		// TX empty interrupt drains the ring
+	}
+	do
+	{
+		uartRegRead(XUARTPS_SR_OFFSET, &u4Status, pCfgInstance);
+	} while((u4Status & u4IdleMask) != ((RUINT32)0x01 << XUARTPS_SR_TXEMPTY));
+
+	return XST_SUCCESS;
+}
+
+/*
+ * returns number of bytes that can be queued to the TX ring
+ */
+RUINT32 UartTxFree(uartCfgType *pCfgInstance)
+{
+	uartDeviceContextType *pContext = uartGetContext(pCfgInstance);
+
+	if(pContext == NULL)
+	{
+		return 0U;
+	}
+	return (pContext->TxRing.u4Mask + 1U) - (pContext->TxRing.u4Head - pContext->TxRing.u4Tail);
+}
+
+/*
+ * zero copy access to TX ring for producers that build data in place (e.g. packet encoders).
+ * sets *ppu1Data to the free ring slot u4Offset bytes after the current head and returns number
+ * of bytes writable there without wrapping. written bytes are not sent until UartTxCommit.
+ */
+RUINT32 UartTxReserve(uartCfgType *pCfgInstance, RUINT32 u4Offset, RUINT8 **ppu1Data)
+{
+	uartDeviceContextType *pContext = uartGetContext(pCfgInstance);
+	uartRingType *pRing;
+	RUINT32 u4Free;
+	RUINT32 u4Position;
+	RUINT32 u4Contiguous;
+
+	if((pContext == NULL) || (ppu1Data == NULL))
+	{
+		return 0U;
+	}
+
+	pRing = &pContext->TxRing;
+	u4Free = (pRing->u4Mask + 1U) - (pRing->u4Head - pRing->u4Tail);
+	if(u4Offset >= u4Free)
+	{
+		return 0U;
+	}
+
+	u4Position = (pRing->u4Head + u4Offset) & pRing->u4Mask;
+	u4Contiguous = (pRing->u4Mask + 1U) - u4Position;
+	if(u4Contiguous > (u4Free - u4Offset))
+	{
+		u4Contiguous = u4Free - u4Offset;
+	}
+
+	*ppu1Data = &pRing->pu1Buffer[u4Position];
+	return u4Contiguous;
+}
+
+/*
+ * publishes u4Size bytes written after UartTxReserve and starts TX empty interrupt driven transmit
+ */
+ReturnType UartTxCommit(uartCfgType *pCfgInstance, RUINT32 u4Size)
+{
+	uartDeviceContextType *pContext = uartGetContext(pCfgInstance);
+	uartRingType *pRing;
+
+	if(pContext == NULL)
+	{
+		return XST_FAILURE;
+	}
+
+	pRing = &pContext->TxRing;
+	if(u4Size > ((pRing->u4Mask + 1U) - (pRing->u4Head - pRing->u4Tail)))
+	{
+		return XST_FAILURE;
+	}
+
+	if(u4Size != 0U)
+	{
+		dmb(); // data has to be visible before consumer sees the new head
+		pRing->u4Head += u4Size;
+		uartRegWrite(XUARTPS_IER_OFFSET, ((RUINT32)0x01 << XUARTPS_IXR_TXEMPTY), pCfgInstance);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*
+ * consumer side of the TX ring, called from interrupt context on TX empty.
+ * fifo is not always empty here : first byte written to an idle transmitter moves to the shift register
+ * at once and raises TX empty again while the rest of the refill is written, so fifo status is checked.
+ * TX empty interrupt is disabled once the ring is drained.
+ */
+static void uartTxRefill(uartCfgType *pCfgInstance)
+{
+	uartDeviceContextType *pContext = uartGetContext(pCfgInstance);
+	uartRingType *pRing;
+	RUINT32 u4Tail;
+	RUINT32 u4Count;
+	RUINT32 u4Contiguous;
+	RUINT32 u4Written;
+
+	if(pContext == NULL)
+	{
+		return;
+	}
+
+	pRing = &pContext->TxRing;
+	u4Tail = pRing->u4Tail;
+	u4Count = pRing->u4Head - u4Tail;
+	dmb(); // read head before reading data it covers
+
+	if(u4Count > UART_TX_FIFO_DEPTH)
+	{
+		u4Count = UART_TX_FIFO_DEPTH;
+	}
+
+	// at most two chunks - up to end of ring storage and from the beginning
+	u4Contiguous = (pRing->u4Mask + 1U) - (u4Tail & pRing->u4Mask);
+	if(u4Contiguous > u4Count)
+	{
+		u4Contiguous = u4Count;
+	}
+	u4Written = txFifoFill(&pRing->pu1Buffer[u4Tail & pRing->u4Mask], u4Contiguous, pCfgInstance);
+	if((u4Written == u4Contiguous) && (u4Count > u4Contiguous))
+	{
+		u4Written += txFifoFill(pRing->pu1Buffer, u4Count - u4Contiguous, pCfgInstance);
+	}
+	u4Count = u4Written;
+
+	dmb(); // data is consumed before slots are given back to producer
+	pRing->u4Tail = u4Tail + u4Count;
+	UART_STATS_INC(pContext, u4TxInterruptCount);
+	UART_STATS_ADD(pContext, u4TxByteCount, u4Count);
+
+	if(pRing->u4Head == pRing->u4Tail)
+	{
+		// nothing left to send - stop TX empty interrupt, UartSendDataNonBlocking enables it again
+		uartRegWrite(XUARTPS_IDR_OFFSET, ((RUINT32)0x01 << XUARTPS_IXR_TXEMPTY), pCfgInstance);
+	}
+}
+
+/*
+ * copies run time counters of the instance to pStats.
+ * only the receive error counters are there if statistics are compiled out.
+ */
+ReturnType UartGetStats(uartCfgType *pCfgInstance, uartStatsType *pStats)
+{
+	uartDeviceContextType *pContext = uartGetContext(pCfgInstance);
+
+	if((pContext == NULL) || (pStats == NULL))
+	{
+		return XST_FAILURE;
+	}
+
+	*pStats = pContext->Stats;
+	return XST_SUCCESS;
+}
+
+/*
+ * clears run time counters of the instance. an interrupt taken while clearing may leave
+ * one of its counters uncleared, call with the uart interrupt masked for an exact start.
+ */
+ReturnType UartResetStats(uartCfgType *pCfgInstance)
+{
+	uartDeviceContextType *pContext = uartGetContext(pCfgInstance);
+
+	if(pContext == NULL)
+	{
+		return XST_FAILURE;
+	}
+
+	memset(&pContext->Stats, 0, sizeof(uartStatsType));
+	return XST_SUCCESS;
+}
+
+/*
+ * dumps run time counters of the instance to the console (stdout uart).
+ * link is CPU bound if mean ISR time gets close to the time of one interrupt worth of bytes on the wire,
+ * wire bound if bytes per interrupt stay near the trigger level with short ISR times.
+ */
+ReturnType UartPrintStats(uartCfgType *pCfgInstance)
+{
+	uartStatsType Stats;
+#if UART_STATS_ENABLE
+	RUINT32 u4RxPerIrq = 0U;
+	RUINT32 u4TxPerIrq = 0U;
+	RUINT32 u4CyclesPerIrq = 0U;
+#endif
+
+	if(UartGetStats(pCfgInstance, &Stats) != XST_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
+
+#if UART_STATS_ENABLE
+	if(Stats.u4RxInterruptCount != 0U)
+	{
+		u4RxPerIrq = Stats.u4RxByteCount / Stats.u4RxInterruptCount;
+	}
+	if(Stats.u4TxInterruptCount != 0U)
+	{
+		u4TxPerIrq = Stats.u4TxByteCount / Stats.u4TxInterruptCount;
+	}
+	if(Stats.u4InterruptCount != 0U)
+	{
+		u4CyclesPerIrq = Stats.u4IsrCycleTotal / Stats.u4InterruptCount;
+	}
+
+	xil_printf("uart%d : irq %u, isr cycles mean %u max %u\r\n", pCfgInstance->DeviceNum,
+			Stats.u4InterruptCount, u4CyclesPerIrq, Stats.u4IsrCycleMax);
+	xil_printf("  tx : bytes %u, irq %u, bytes/irq %u\r\n", Stats.u4TxByteCount, Stats.u4TxInterruptCount, u4TxPerIrq);
+	xil_printf("  rx : bytes %u, irq %u, bytes/irq %u, timeouts %u, fifo high water %u\r\n", Stats.u4RxByteCount,
+			Stats.u4RxInterruptCount, u4RxPerIrq, Stats.u4RxTimeoutCount, Stats.u4RxFifoHighWater);
+#else
+	xil_printf("uart%d :\r\n", pCfgInstance->DeviceNum);
+#endif
+	xil_printf("  rx errors : dropped %u, overrun %u, framing %u, parity %u, flow stop %u\r\n", Stats.u4RxDroppedCount,
+			Stats.u4RxOverrunCount, Stats.u4RxFramingErrorCount, Stats.u4RxParityErrorCount, Stats.u4RxFlowStopCount);
+
+	return XST_SUCCESS;
+}
+
+/*
+ * producer side of the RX ring, called from interrupt context.
+ * reads RX fifo until empty, bytes are written straight into ring slots.
+ * bytes that do not fit into the ring are read out of the fifo and dropped.
+ * returns number of bytes read from the fifo.
+ */
+static RUINT32 uartRxDrain(uartCfgType *pCfgInstance)
+{
+	uartDeviceContextType *pContext = uartGetContext(pCfgInstance);
+	uartRingType *pRing;
+	RUINT32 u4Head;
+	RUINT32 u4Free;
+	RUINT32 u4Stored = 0U;
+	RUINT32 u4Read = 0U;
+	RUINT32 u4Data;
+
+	if(pContext == NULL)
+	{
+		return 0U;
+	}
+
+	pRing = &pContext->RxRing;
+	u4Head = pRing->u4Head;
+	u4Free = (pRing->u4Mask + 1U) - (u4Head - pRing->u4Tail);
+
+	while(!isRxFifoEmpty(pCfgInstance))
+	{
+		uartRegRead(XUARTPS_FIFO_OFFSET, &u4Data, pCfgInstance);
+		u4Read++;
+		if(u4Stored < u4Free)
+		{
+			pRing->pu1Buffer[(u4Head + u4Stored) & pRing->u4Mask] = (RUINT8)u4Data;
+			u4Stored++;
+		}
+	}
+
+	dmb(); // data has to be visible before consumer sees the new head
+	pRing->u4Head = u4Head + u4Stored;
+	pContext->Stats.u4RxDroppedCount += (u4Read - u4Stored);
+
+	return u4Read;
+}
+
+/*
+ * zero copy access to received data : sets *ppu1Data to the oldest received byte
+ * inside the RX ring and returns number of bytes readable there without wrapping.
+ * data stays valid until UartRxConsume is called.
+ */
+RUINT32 UartRxPeek(uartCfgType *pCfgInstance, RUINT8 **ppu1Data)
+{
+	uartDeviceContextType *pContext = uartGetContext(pCfgInstance);
+	uartRingType *pRing;
+	RUINT32 u4Tail;
+	RUINT32 u4Count;
+	RUINT32 u4Contiguous;
+
+	if((pContext == NULL) || (ppu1Data == NULL))
+	{
+		return 0U;
+	}
+
+	pRing = &pContext->RxRing;
+	u4Tail = pRing->u4Tail;
+	u4Count = pRing->u4Head - u4Tail;
+	dmb(); // read head before reading data it covers
+
+	u4Contiguous = (pRing->u4Mask + 1U) - (u4Tail & pRing->u4Mask);
+	if(u4Count < u4Contiguous)
+	{
+		u4Contiguous = u4Count;
+	}
+
+	*ppu1Data = &pRing->pu1Buffer[u4Tail & pRing->u4Mask];
+	return u4Contiguous;
+}
+
+/*
+ * releases u4Size bytes returned by UartRxPeek back to the receive interrupt
+ */
+void UartRxConsume(uartCfgType *pCfgInstance, RUINT32 u4Size)
+{
+	uartDeviceContextType *pContext = uartGetContext(pCfgInstance);
+	uartRingType *pRing;
+	RUINT32 u4Count;
+
+	if(pContext == NULL)
+	{
+		return;
+	}
+
+	pRing = &pContext->RxRing;
+	u4Count = pRing->u4Head - pRing->u4Tail;
+	if(u4Size > u4Count)
+	{
+		u4Size = u4Count;
+	}
+
+	dmb(); // data is consumed before slots are given back to producer
+	pRing->u4Tail += u4Size;
+}
+
+/*
+ * RxCallback(pArgument) is run as GIC deferred work, outside of interrupt context, after
+ * new bytes are put into the RX ring. Callback is expected to consume them with UartRead / UartRxPeek.
+ * NULL callback stops notifications.
+ */
+ReturnType UartSetRxCallback(uartCfgType *pCfgInstance, uartRxCallbackType RxCallback, void *pArgument)
+{
+	uartDeviceContextType *pContext = uartGetContext(pCfgInstance);
+
+	if(pContext == NULL)
+	{
+		return XST_FAILURE;
+	}
+
+	pContext->RxCallback = NULL; // receive interrupt must not see a new callback with the old argument
+	dmb();
+	pContext->pRxCallbackArgument = pArgument;
+	dmb();
+	pContext->RxCallback = RxCallback;
+
+	return XST_SUCCESS;
+}
+
+/*
+ * deferred part of receive interrupt, runs with interrupts enabled
+ */
+static void uartRxDeferredWork(void *pArgument)
+{
+	uartDeviceContextType *pContext = (uartDeviceContextType *)pArgument;
+	uartRxCallbackType RxCallback = pContext->RxCallback;
+
+	// cleared before callback so that data arriving while callback runs posts the work again
+	pContext->u4RxWorkPending = 0U;
+	if(RxCallback != NULL)
+	{
+		RxCallback(pContext->pRxCallbackArgument);
+	}
+}
+
+/*
+ * copies up to u4MaxSize received bytes to pu1Buffer and returns number of bytes copied.
+ * does not block, returns 0 if nothing was received.
+ */
+RUINT32 UartRead(uartCfgType *pCfgInstance, RUINT8 *pu1Buffer, RUINT32 u4MaxSize)
+{
+	RUINT8 *pu1Data;
+	RUINT32 u4Copied = 0U;
+	RUINT32 u4Chunk;
+
+	if(pu1Buffer == NULL)
+	{
+		return 0U;
+	}
+
+	// at most two chunks - up to end of ring storage and from the beginning
+	while(u4Copied < u4MaxSize)
+	{
+		u4Chunk = UartRxPeek(pCfgInstance, &pu1Data);
+		if(u4Chunk == 0U)
+		{
+			break;
+		}
+		if(u4Chunk > (u4MaxSize - u4Copied))
+		{
+			u4Chunk = u4MaxSize - u4Copied;
+		}
+		memcpy(&pu1Buffer[u4Copied], pu1Data, u4Chunk);
+		UartRxConsume(pCfgInstance, u4Chunk);
+		u4Copied += u4Chunk;
+	}
+
+	return u4Copied;
 }
 
 ReturnType UartReceiveDataPolling(RUINT8 *pu1Data, uartCfgType *pCfgInstance, RUINT32 Size)
@@ -617,20 +1564,33 @@ static ReturnType receiveData(RUINT8 *pu1Data, RUINT32 u4Size, uartCfgType *pCfg
 static ReturnType enableInterrupt(uartCfgType *pCfgInstance)
 {
 
-	RUINT32 u4TempRxTriggerLevel = 0x1U; // previously 32 byte data
+	RUINT32 u4TempRxTriggerLevel = uartGetRxTriggerLevel(pCfgInstance);
 	RUINT32 u4TempReadRegister = 0;
 	RUINT32 u4TempHighVal = 0x01U;
+	RUINT32 u4TempIntMask = (u4TempHighVal << XUARTPS_IXR_RXOVR);
+
+	/*
+	 * interrupt coalescing : RX trigger fires once u4TempRxTriggerLevel bytes are buffered,
+	 * receiver timeout flushes the bytes of a short tail packet that stays below trigger level
+	 */
 	//program trigger level
 	uartRegWrite(XUARTPS_RXWM_OFFSET, u4TempRxTriggerLevel, pCfgInstance);
 
+	if(uartGetRxTimeout(pCfgInstance) != 0U)
+	{
+		u4TempIntMask |= (u4TempHighVal << XUARTPS_IXR_TOUT);
+	}
+
+	// receive errors are only counted, overrun also drains the fifo
+	u4TempIntMask |= (u4TempHighVal << XUARTPS_IXR_OVER) | (u4TempHighVal << XUARTPS_IXR_FRAMING) |
+			(u4TempHighVal << XUARTPS_IXR_PARITY);
+
 	//enable interrupt
-	// set IER RX FIFO trigger register
-	// clear IDR RX FIFO trigger register
-	// read IER RX FIFO trigger register to check settings
-	uartSetRegBit (XUARTPS_IER_OFFSET, XUARTPS_IXR_RXOVR, pCfgInstance);
-	uartClearRegBit(XUARTPS_IDR_OFFSET, XUARTPS_IXR_RXOVR, pCfgInstance);
+	// set IER RX FIFO trigger (and receiver timeout) bits, IER is write only - 1 enables the bit
+	// read IMR to check settings
+	uartRegWrite(XUARTPS_IER_OFFSET, u4TempIntMask, pCfgInstance);
 	uartRegRead(XUARTPS_IMR_OFFSET, &u4TempReadRegister, pCfgInstance);
-	if((u4TempReadRegister & (u4TempHighVal << XUARTPS_IXR_RXOVR)) == 0x01)
+	if((u4TempReadRegister & u4TempIntMask) == u4TempIntMask)
 	{
 		// interrupt enabled - proceed
 		return XST_SUCCESS;
@@ -648,10 +1608,14 @@ void xUartPsInterruptHandler(uartCfgType *pCfgInstance)
 {
     RUINT32 u4IsrStatus;
     RUINT32 u4TempMaskReg;
-    RUINT32 u4TempAddr = a1UartRxArray;
     RUINT32 u4TempRead;
     RUINT32 u4TempLogicHigh = 0x1U;
     RUINT32 u4ReceivedDataSize = 0;
+    uartDeviceContextType *pContext = uartGetContext(pCfgInstance);
+#if UART_STATS_ENABLE
+    RUINT32 u4EntryCycle = PmuReadCycleCounter();
+    RUINT32 u4IsrCycles;
+#endif
 
     /*
      * Read the interrupt ID register to determine which
@@ -662,25 +1626,85 @@ void xUartPsInterruptHandler(uartCfgType *pCfgInstance)
     uartRegRead(XUARTPS_IMR_OFFSET, &u4TempMaskReg, pCfgInstance);
     u4IsrStatus &= u4TempMaskReg;
 
+    /* Clear the interrupt status since UART interrup status bits are sticky, meaning : unless they are cleared by writing 1 to the
+     * position of the bit that is logic high which would result in '0' - logic low in that bit position, these interrupts would keep going.
+     * Status is cleared before servicing so that a TX empty event raised while refilling the fifo is not lost */
+    uartRegWrite(XUARTPS_ISR_OFFSET, u4IsrStatus, pCfgInstance);
+
+    if ((u4IsrStatus & (u4TempLogicHigh << XUARTPS_IXR_TXEMPTY)) != 0U)
+    {
+        /* TX fifo drained - refill from TX ring */
+        uartTxRefill(pCfgInstance);
+    }
+
+    /* receive errors */
+    if((pContext != NULL) && ((u4IsrStatus & ((u4TempLogicHigh << XUARTPS_IXR_OVER) | (u4TempLogicHigh << XUARTPS_IXR_FRAMING) |
+    		(u4TempLogicHigh << XUARTPS_IXR_PARITY))) != 0U))
+    {
+        if((u4IsrStatus & (u4TempLogicHigh << XUARTPS_IXR_OVER)) != 0U)
+        {
+            pContext->Stats.u4RxOverrunCount++;
+        }
+        if((u4IsrStatus & (u4TempLogicHigh << XUARTPS_IXR_FRAMING)) != 0U)
+        {
+            pContext->Stats.u4RxFramingErrorCount++;
+        }
+        if((u4IsrStatus & (u4TempLogicHigh << XUARTPS_IXR_PARITY)) != 0U)
+        {
+            pContext->Stats.u4RxParityErrorCount++;
+        }
+    }
+
     /* Dispatch an appropriate handler. */
-    if ((u4IsrStatus & ((u4TempLogicHigh << XUARTPS_IXR_RXOVR) | (u4TempLogicHigh <<XUARTPS_IXR_RXEMPTY) | (u4TempLogicHigh << XUARTPS_IXR_RXFULL))) != 0U)
+    if ((u4IsrStatus & ((u4TempLogicHigh << XUARTPS_IXR_RXOVR) | (u4TempLogicHigh <<XUARTPS_IXR_RXEMPTY) |
+    		(u4TempLogicHigh << XUARTPS_IXR_RXFULL) | (u4TempLogicHigh << XUARTPS_IXR_TOUT) |
+    		(u4TempLogicHigh << XUARTPS_IXR_OVER))) != 0U)
     {
-        /* Received data interrupt */
-		while(!isRxFifoEmpty(pCfgInstance))
+        /* sender is being held off by RTS - fifo reached flow delay level before this interrupt was serviced */
+        if((pContext != NULL) && (pContext->Cfg.FlowControl == UART_FLOW_CONTROL_RTS_CTS))
+        {
+            uartRegRead(XUARTPS_SR_OFFSET, &u4TempRead, pCfgInstance);
+            if((u4TempRead & (u4TempLogicHigh << XUARTPS_SR_FLOWDEL)) != 0U)
+            {
+                pContext->Stats.u4RxFlowStopCount++;
+            }
+        }
+
+        /* Received data interrupt - drain whole fifo into RX ring, not only the trigger level */
+		u4ReceivedDataSize = uartRxDrain(pCfgInstance);
+
+		if(pContext != NULL)
 		{
-			uartRegRead(XUARTPS_FIFO_OFFSET, (RUINT32 *)(u4TempAddr + u4ReceivedDataSize), pCfgInstance);// read if rx fifo is not empty
-			u4ReceivedDataSize++;
+			UART_STATS_INC(pContext, u4RxInterruptCount);
+			UART_STATS_ADD(pContext, u4RxByteCount, u4ReceivedDataSize);
+			UART_STATS_MAX(pContext, u4RxFifoHighWater, u4ReceivedDataSize);
+			if((u4IsrStatus & (u4TempLogicHigh << XUARTPS_IXR_TOUT)) != 0U)
+			{
+				UART_STATS_INC(pContext, u4RxTimeoutCount);
+			}
+
+			/* processing of received data is done out of interrupt context - post it once per batch */
+			if((pContext->RxCallback != NULL) && (pContext->u4RxWorkPending == 0U))
+			{
+				pContext->u4RxWorkPending = 1U;
+				if(GICPostDeferredWork(uartRxDeferredWork, pContext) != GIC_SUCCESS)
+				{
+					pContext->u4RxWorkPending = 0U; // queue full, try again on next interrupt
+				}
+			}
 		}
     }
 
-    /* Clear the interrupt status since UART interrup status bits are sticky, meaning : unless they are cleared by writing 1 to the
-     * position of the bit that is logic high which would result in '0' - logic low in that bit position, these interrupts would keep going */
-    uartRegWrite(XUARTPS_ISR_OFFSET, u4IsrStatus, pCfgInstance);
-
-    UartSendData(a1UartRxArray, pCfgInstance, u4ReceivedDataSize);
-
-    //    TxDataPolling((RUINT8 *)u4TempAddr, u4ReceivedDataSize, pCfgInstance);
-    //    u4ReceivedDataSize = 0;
+#if UART_STATS_ENABLE
+    if(pContext != NULL)
+    {
+        // unsigned difference stays correct across one counter wrap
+        u4IsrCycles = PmuReadCycleCounter() - u4EntryCycle;
+        UART_STATS_INC(pContext, u4InterruptCount);
+        UART_STATS_ADD(pContext, u4IsrCycleTotal, u4IsrCycles);
+        UART_STATS_MAX(pContext, u4IsrCycleMax, u4IsrCycles);
+    }
+#endif
 
     /*clear pending interrupt*/
     // read ICCIAR register(0xF8F0010C)(Interrupt acknowledge register) to figure out which interurpts are pending/active
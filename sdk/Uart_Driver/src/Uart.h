@@ -12,6 +12,30 @@
 /**************Macros******************/
 #define SHIFT_LEFT(x,y) x<<y
 #define SHIFT_RIGHT(x,y) x>>y
+
+#define UART_NUMBER_OF_INSTANCES 2U
+#define UART_TX_FIFO_DEPTH 64U // PS uart TX fifo size in bytes
+#define UART_TX_RING_SIZE 1024U // software TX ring size in bytes, must be power of two
+#define UART_RX_FIFO_DEPTH 64U // PS uart RX fifo size in bytes
+#define UART_RX_RING_SIZE 1024U // software RX ring size in bytes, must be power of two
+#define UART_DEFAULT_RX_TRIGGER_LEVEL 32U // RX fifo level that raises RX trigger interrupt
+#define UART_DEFAULT_RX_TIMEOUT 10U // RX timeout in units of 4 bit periods
+#define UART_RX_TIMEOUT_DISABLED 0xFFU // u1RxTimeout value that leaves the receiver timeout off
+#define UART_DEFAULT_FLOW_DELAY 56U // RX fifo level that deasserts RTS when hardware flow control is on
+#define UART_FLOW_DELAY_MIN 4U // flow delay register values below 4 disable the function in hardware
+#define UART_BAUD_MAX_ERROR_PPM 25000U // InitializeUart fails if closest achievable rate is off by more (2.5%)
+
+/*traffic counters and ISR cycle measurement, build with UART_STATS_ENABLE=0 to compile them out. error counters are always kept*/
+#ifndef UART_STATS_ENABLE
+#define UART_STATS_ENABLE 1
+#endif
+/*
+ * build with UART_HOST_MODEL=1 to route controller and SLCR register accesses to UartHostModelRead / UartHostModelWrite
+ * instead of the memory mapped registers, same seam as GIC_HOST_MODEL. addresses are the physical register addresses.
+ */
+#ifndef UART_HOST_MODEL
+#define UART_HOST_MODEL 0
+#endif
 /**************Definitions******************/
 typedef enum {
 	UART_PARITY_EVEN = 0,
@@ -19,11 +43,21 @@ typedef enum {
 	UART_PARITY_NONE
 } uartParityType;
 
+/*any rate can be requested, divisors are solved at run time. listed ones are validated rates*/
 typedef enum {
 	UART_BAUDRATE_115200 = 115200,
-	UART_BAUDRATE_921600 = 921600
+	UART_BAUDRATE_921600 = 921600,
+	UART_BAUDRATE_1500000 = 1500000,
+	UART_BAUDRATE_2000000 = 2000000,
+	UART_BAUDRATE_3000000 = 3000000
 } uartBaudRateType;
 
+/*RTS / CTS of PS uarts are only available through EMIO, they have to be routed in the PL design*/
+typedef enum {
+	UART_FLOW_CONTROL_NONE = 0,
+	UART_FLOW_CONTROL_RTS_CTS
+} uartFlowControlType;
+
 typedef enum {
 	UART_INSTANCE_DEVICE_0 = 0,
 	UART_INSTANCE_DEVICE_1 = 1
@@ -39,8 +73,50 @@ typedef struct {
 	RUINT32 u4ControlRegister;
 	uartBaudRateType BaudRate;
 	uartParityType Parity;
+	RUINT8 u1RxTriggerLevel; // 1..63 bytes, 0 selects UART_DEFAULT_RX_TRIGGER_LEVEL
+	RUINT8 u1RxTimeout; // idle time in 4 bit periods before buffered bytes are reported, 1..254, 0 selects UART_DEFAULT_RX_TIMEOUT, UART_RX_TIMEOUT_DISABLED turns it off
+	uartFlowControlType FlowControl;
+	RUINT8 u1FlowDelay; // RX fifo level deasserting RTS, 4..63 and above trigger level, 0 selects UART_DEFAULT_FLOW_DELAY
 } uartCfgType;
 
+/*
+ * bytes per interrupt : u4RxByteCount / u4RxInterruptCount and u4TxByteCount / u4TxInterruptCount.
+ * mean ISR time : u4IsrCycleTotal / u4InterruptCount CPU cycles, total wraps after 2^32 cycles spent in ISR
+ */
+typedef struct {
+	/*receive error counters*/
+	RUINT32 u4RxDroppedCount; // bytes drained while RX ring was full
+	RUINT32 u4RxOverrunCount; // RX fifo overflows, bytes were lost in hardware
+	RUINT32 u4RxFramingErrorCount;
+	RUINT32 u4RxParityErrorCount;
+	RUINT32 u4RxFlowStopCount; // receive interrupts taken while RTS was held off by flow delay level
+#if UART_STATS_ENABLE
+	RUINT32 u4InterruptCount; // all uart interrupts of the instance
+	RUINT32 u4IsrCycleTotal; // CPU cycles from ISR entry to exit, summed
+	RUINT32 u4IsrCycleMax;
+	RUINT32 u4TxInterruptCount; // TX empty interrupts that refilled the fifo
+	RUINT32 u4TxByteCount; // bytes written to TX fifo, interrupt driven and polling
+	RUINT32 u4RxInterruptCount; // receive interrupts (trigger + timeout) taken
+	RUINT32 u4RxTimeoutCount; // receive interrupts raised by receiver timeout
+	RUINT32 u4RxByteCount; // bytes drained from RX fifo in interrupt context
+	RUINT32 u4RxFifoHighWater; // most bytes found in RX fifo by one interrupt
+#endif
+} uartStatsType;
+
+/*
+ * baud rate generator setting : baud = sel_clk / (CD * (BDIV + 1))
+ * sel_clk is uart_ref_clk, or uart_ref_clk / 8 if MR_CLKSEL is set
+ */
+typedef struct {
+	RUINT32 u4Cd; // baud rate generator register value, 1..65535
+	RUINT32 u4Bdiv; // baud rate divider register value, 4..255
+	RUINT32 u4ClkSelDiv8; // 1 : MR_CLKSEL is set
+	RUINT32 u4ActualBaudRate;
+	RUINT32 u4ErrorPpm; // |actual - requested| / requested in parts per million
+} uartBaudDivisorType;
+
+typedef void (*uartRxCallbackType)(void *pArgument);
+
 typedef struct {
 	RINT32 *TxDataFifo;
 	RUINT32 *RxDataFifo;
@@ -53,8 +129,30 @@ typedef struct {
 
 /**************Prototypes******************/
 //static void configureUartregister(const uartConfigureType *cpConfig);
+ReturnType initializeUartCfg(uartCfgType *cfgInstance);
 ReturnType InitializeUart(uartCfgType *cfgInstance);
+ReturnType InitializeUartMulti(uartCfgType **ppCfgInstances, RUINT32 u4NumOfInstances);
 ReturnType UartSendData(RUINT8 *pu1Data, uartCfgType *pCfgInstance, RUINT32 Size);
+RUINT32 UartSendDataNonBlocking(RUINT8 *pu1Data, uartCfgType *pCfgInstance, RUINT32 Size);
+RUINT32 UartTxPending(uartCfgType *pCfgInstance);
+RUINT32 UartTxFree(uartCfgType *pCfgInstance);
+ReturnType UartTxWaitIdle(uartCfgType *pCfgInstance);
+RUINT32 UartTxReserve(uartCfgType *pCfgInstance, RUINT32 u4Offset, RUINT8 **ppu1Data);
+ReturnType UartTxCommit(uartCfgType *pCfgInstance, RUINT32 u4Size);
+ReturnType UartGetStats(uartCfgType *pCfgInstance, uartStatsType *pStats);
+ReturnType UartResetStats(uartCfgType *pCfgInstance);
+ReturnType UartPrintStats(uartCfgType *pCfgInstance);
+RUINT32 UartRead(uartCfgType *pCfgInstance, RUINT8 *pu1Buffer, RUINT32 u4MaxSize);
+RUINT32 UartRxPeek(uartCfgType *pCfgInstance, RUINT8 **ppu1Data);
+void UartRxConsume(uartCfgType *pCfgInstance, RUINT32 u4Size);
+ReturnType UartSetRxCallback(uartCfgType *pCfgInstance, uartRxCallbackType RxCallback, void *pArgument);
+ReturnType UartSolveBaudRate(RUINT32 u4RefClkHz, RUINT32 u4BaudRate, uartBaudDivisorType *pDivisor);
+RUINT32 UartGetRefClockHz(void);
+ReturnType UartGetBaudRateInfo(uartCfgType *pCfgInstance, uartBaudDivisorType *pDivisor);
 void xUartPsInterruptHandler(uartCfgType *pCfgInstance);
+#if UART_HOST_MODEL
+RUINT32 UartHostModelRead(RUINT32 u4Addr);
+void UartHostModelWrite(RUINT32 u4Addr, RUINT32 u4Value);
+#endif
 
 #endif /* SRC_UARTDRIVER_UART_H_ */
@@ -0,0 +1,396 @@
+/*
+ * UartPacket.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * Packet layer on top of Uart driver for telemetry / command links
+ * Frame on the wire : END | SLIP( payload | CRC high | CRC low ) | END
+ * CRC is CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF, no final xor). Running it over
+ * payload and the appended CRC gives 0, which is how received frames are validated.
+ * TX : frames are SLIP encoded on the fly straight into the uart TX ring, TX empty interrupt
+ * moves them to the TX fifo. Segments are encoded one after the other so a header and a
+ * payload living in different buffers are sent as one frame without being copied together.
+ * RX : if a whole frame is already in RX ring storage without wrapping, it is decoded in place
+ * there and returned without copy. Otherwise it is decoded into a per instance staging buffer
+ * while being read out of the ring.
+ */
+
+/**************Includes******************/
+#include "UartPacket.h"
+#include <string.h>
+
+/**************Preprocessor******************/
+#define CRC16_INIT 0xFFFFU
+
+/**************Definitions******************/
+typedef struct {
+	uartCfgType *pCfgInstance;
+	RUINT8 *pu1Window; // writable part of TX ring
+	RUINT32 u4WindowSize;
+	RUINT32 u4Written; // bytes written into TX ring, not committed yet
+} packetWriterType;
+
+typedef struct {
+	RUINT8 a1Frame[UART_PACKET_MAX_FRAME_SIZE]; // staging for frames that are not contiguous in RX ring
+	RUINT32 u4FrameSize;
+	RUINT32 u4Escaped; // last byte was SLIP_ESC
+	RUINT32 u4Overflow; // frame being staged is too long and will be dropped
+	RUINT32 u4InRingFrameSize; // ring bytes of a frame returned in place, consumed on next receive call
+	uartPacketStatsType Stats;
+} packetRxStateType;
+
+static packetRxStateType sPacketRx[UART_NUMBER_OF_INSTANCES];
+
+static const RUINT16 au2Crc16Table[256] = {
+	0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+	0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+	0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+	0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+	0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+	0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+	0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+	0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+	0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+	0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+	0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+	0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+	0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+	0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+	0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+	0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+	0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+	0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+	0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+	0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+	0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+	0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+	0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+	0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+	0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+	0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+	0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+	0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+	0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+	0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+	0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+	0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U
+};
+
+/**************Function Prototypes******************/
+static packetRxStateType* packetGetState(uartCfgType *pCfgInstance);
+static void packetPutByte(packetWriterType *pWriter, RUINT8 u1Byte);
+static void packetPutEscaped(packetWriterType *pWriter, RUINT8 u1Byte);
+static RUINT32 slipDecode(packetRxStateType *pState, const RUINT8 *pu1In, RUINT32 u4InSize,
+		RUINT8 *pu1Out, RUINT32 *pu4OutSize, RUINT32 u4OutMax, RUINT32 *pu4Complete);
+static RUINT32 packetCheckFrame(packetRxStateType *pState, const RUINT8 *pu1Frame, RUINT32 u4Size);
+
+
+static packetRxStateType* packetGetState(uartCfgType *pCfgInstance)
+{
+	if((pCfgInstance == NULL) || ((RUINT32)pCfgInstance->DeviceNum >= UART_NUMBER_OF_INSTANCES))
+	{
+		return NULL;
+	}
+	return &sPacketRx[pCfgInstance->DeviceNum];
+}
+
+/*
+ * writes one byte to TX ring. free space is checked by the caller for the whole frame,
+ * a new window is only needed when the previous one ends at the end of ring storage.
+ */
+static void packetPutByte(packetWriterType *pWriter, RUINT8 u1Byte)
+{
+	if(pWriter->u4WindowSize == 0U)
+	{
+		pWriter->u4WindowSize = UartTxReserve(pWriter->pCfgInstance, pWriter->u4Written, &pWriter->pu1Window);
+	}
+
+	*pWriter->pu1Window = u1Byte;
+	pWriter->pu1Window++;
+	pWriter->u4WindowSize--;
+	pWriter->u4Written++;
+}
+
+static void packetPutEscaped(packetWriterType *pWriter, RUINT8 u1Byte)
+{
+	if(u1Byte == SLIP_END)
+	{
+		packetPutByte(pWriter, SLIP_ESC);
+		packetPutByte(pWriter, SLIP_ESC_END);
+	}
+	else if(u1Byte == SLIP_ESC)
+	{
+		packetPutByte(pWriter, SLIP_ESC);
+		packetPutByte(pWriter, SLIP_ESC_ESC);
+	}
+	else
+	{
+		packetPutByte(pWriter, u1Byte);
+	}
+}
+
+/*
+ * SLIP decodes pu1In into pu1Out until END or end of input. pu1Out can be pu1In, output never
+ * gets ahead of input. *pu4OutSize is the running output size, bytes past u4OutMax are dropped.
+ * returns number of input bytes used, *pu4Complete is set to 1 if END was reached.
+ */
+static RUINT32 slipDecode(packetRxStateType *pState, const RUINT8 *pu1In, RUINT32 u4InSize,
+		RUINT8 *pu1Out, RUINT32 *pu4OutSize, RUINT32 u4OutMax, RUINT32 *pu4Complete)
+{
+	RUINT32 u4Index;
+	RUINT32 u4OutSize = *pu4OutSize;
+	RUINT8 u1Byte;
+
+	*pu4Complete = 0U;
+
+	for(u4Index = 0U; u4Index < u4InSize; u4Index++)
+	{
+		u1Byte = pu1In[u4Index];
+
+		if(u1Byte == SLIP_END)
+		{
+			pState->u4Escaped = 0U;
+			*pu4Complete = 1U;
+			u4Index++;
+			break;
+		}
+		else if(pState->u4Escaped != 0U)
+		{
+			pState->u4Escaped = 0U;
+			if(u1Byte == SLIP_ESC_END)
+			{
+				u1Byte = SLIP_END;
+			}
+			else if(u1Byte == SLIP_ESC_ESC)
+			{
+				u1Byte = SLIP_ESC;
+			}
+		}
+		else if(u1Byte == SLIP_ESC)
+		{
+			pState->u4Escaped = 1U;
+			continue;
+		}
+
+		if(u4OutSize < u4OutMax)
+		{
+			pu1Out[u4OutSize] = u1Byte;
+			u4OutSize++;
+		}
+		else
+		{
+			pState->u4Overflow = 1U;
+		}
+	}
+
+	*pu4OutSize = u4OutSize;
+	return u4Index;
+}
+
+/*
+ * returns 1 if decoded frame has a valid CRC. empty frames (back to back END) are skipped silently.
+ */
+static RUINT32 packetCheckFrame(packetRxStateType *pState, const RUINT8 *pu1Frame, RUINT32 u4Size)
+{
+	if(u4Size == 0U)
+	{
+		return 0U;
+	}
+
+	if((u4Size < UART_PACKET_CRC_SIZE) || (UartPacketCrc16(CRC16_INIT, pu1Frame, u4Size) != 0U))
+	{
+		pState->Stats.u4RxCrcErrorCount++;
+		return 0U;
+	}
+
+	pState->Stats.u4RxFrameCount++;
+	return 1U;
+}
+
+/*
+ * table driven CRC-16/CCITT-FALSE, pass CRC of previous block as u2Crc to continue over several blocks
+ */
+RUINT16 UartPacketCrc16(RUINT16 u2Crc, const RUINT8 *pu1Data, RUINT32 u4Size)
+{
+	RUINT32 u4Index;
+
+	for(u4Index = 0U; u4Index < u4Size; u4Index++)
+	{
+		u2Crc = (RUINT16)((u2Crc << 8) ^ au2Crc16Table[((u2Crc >> 8) ^ pu1Data[u4Index]) & 0xFFU]);
+	}
+
+	return u2Crc;
+}
+
+/*
+ * Sends segments as one frame. Does not block : returns XST_FAILURE without sending anything
+ * if TX ring cannot take the frame in its worst case (every byte escaped) encoded size.
+ */
+ReturnType UartPacketSendV(uartCfgType *pCfgInstance, const uartPacketSegmentType *pSegments, RUINT32 u4NumOfSegments)
+{
+	packetRxStateType *pState = packetGetState(pCfgInstance);
+	packetWriterType Writer;
+	RUINT32 u4PayloadSize = 0U;
+	RUINT32 u4Segment;
+	RUINT32 u4Index;
+	RUINT16 u2Crc = CRC16_INIT;
+	const RUINT8 *pu1Data;
+
+	if((pState == NULL) || ((pSegments == NULL) && (u4NumOfSegments != 0U)))
+	{
+		return XST_FAILURE;
+	}
+
+	for(u4Segment = 0U; u4Segment < u4NumOfSegments; u4Segment++)
+	{
+		if((pSegments[u4Segment].pu1Data == NULL) && (pSegments[u4Segment].u4Size != 0U))
+		{
+			return XST_FAILURE;
+		}
+		u4PayloadSize += pSegments[u4Segment].u4Size;
+	}
+
+	// two END characters and every payload / CRC byte escaped
+	if((((u4PayloadSize + UART_PACKET_CRC_SIZE) * 2U) + 2U) > UartTxFree(pCfgInstance))
+	{
+		return XST_FAILURE;
+	}
+
+	Writer.pCfgInstance = pCfgInstance;
+	Writer.pu1Window = NULL;
+	Writer.u4WindowSize = 0U;
+	Writer.u4Written = 0U;
+
+	// leading END flushes any line noise received before the frame
+	packetPutByte(&Writer, SLIP_END);
+
+	for(u4Segment = 0U; u4Segment < u4NumOfSegments; u4Segment++)
+	{
+		pu1Data = pSegments[u4Segment].pu1Data;
+		for(u4Index = 0U; u4Index < pSegments[u4Segment].u4Size; u4Index++)
+		{
+			u2Crc = (RUINT16)((u2Crc << 8) ^ au2Crc16Table[((u2Crc >> 8) ^ pu1Data[u4Index]) & 0xFFU]);
+			packetPutEscaped(&Writer, pu1Data[u4Index]);
+		}
+	}
+
+	packetPutEscaped(&Writer, (RUINT8)(u2Crc >> 8));
+	packetPutEscaped(&Writer, (RUINT8)(u2Crc & 0xFFU));
+	packetPutByte(&Writer, SLIP_END);
+
+	pState->Stats.u4TxFrameCount++;
+	return UartTxCommit(pCfgInstance, Writer.u4Written);
+}
+
+ReturnType UartPacketSend(uartCfgType *pCfgInstance, const RUINT8 *pu1Data, RUINT32 u4Size)
+{
+	uartPacketSegmentType Segment;
+
+	Segment.pu1Data = pu1Data;
+	Segment.u4Size = u4Size;
+
+	return UartPacketSendV(pCfgInstance, &Segment, 1U);
+}
+
+/*
+ * Returns next received frame with a valid CRC, CRC is not included in *pu4Size.
+ * *ppu1Frame points either into RX ring storage or into the staging buffer of the instance
+ * and stays valid until the next UartPacketReceive call on the same instance.
+ * returns XST_FAILURE if no complete frame is available yet, partial frames are kept.
+ * must be the only consumer of the instance RX ring.
+ */
+ReturnType UartPacketReceive(uartCfgType *pCfgInstance, RUINT8 **ppu1Frame, RUINT32 *pu4Size)
+{
+	packetRxStateType *pState = packetGetState(pCfgInstance);
+	RUINT8 *pu1Data;
+	RUINT8 *pu1End;
+	RUINT32 u4Available;
+	RUINT32 u4Used;
+	RUINT32 u4OutSize;
+	RUINT32 u4Complete;
+	RUINT32 u4Overflow;
+
+	if((pState == NULL) || (ppu1Frame == NULL) || (pu4Size == NULL))
+	{
+		return XST_FAILURE;
+	}
+
+	// frame returned in place last time is released now
+	if(pState->u4InRingFrameSize != 0U)
+	{
+		UartRxConsume(pCfgInstance, pState->u4InRingFrameSize);
+		pState->u4InRingFrameSize = 0U;
+	}
+
+	while((u4Available = UartRxPeek(pCfgInstance, &pu1Data)) != 0U)
+	{
+		if((pState->u4FrameSize == 0U) && (pState->u4Escaped == 0U) && (pState->u4Overflow == 0U))
+		{
+			// nothing staged - if the whole frame is in this part of the ring, decode it in place
+			pu1End = (RUINT8 *)memchr(pu1Data, SLIP_END, u4Available);
+			if(pu1End != NULL)
+			{
+				u4Used = (RUINT32)(pu1End - pu1Data) + 1U;
+				u4OutSize = 0U;
+				(void)slipDecode(pState, pu1Data, u4Used, pu1Data, &u4OutSize, UART_PACKET_MAX_FRAME_SIZE, &u4Complete);
+				if(pState->u4Overflow != 0U)
+				{
+					// same limit as the staging path, a frame does not get through because it happens to be contiguous
+					pState->u4Overflow = 0U;
+					pState->Stats.u4RxOverflowCount++;
+				}
+				else if(packetCheckFrame(pState, pu1Data, u4OutSize) != 0U)
+				{
+					pState->u4InRingFrameSize = u4Used;
+					*ppu1Frame = pu1Data;
+					*pu4Size = u4OutSize - UART_PACKET_CRC_SIZE;
+					return XST_SUCCESS;
+				}
+				UartRxConsume(pCfgInstance, u4Used);
+				continue;
+			}
+		}
+
+		// frame wraps around ring storage or is not complete yet - move it to staging buffer
+		u4Used = slipDecode(pState, pu1Data, u4Available, pState->a1Frame, &pState->u4FrameSize,
+				UART_PACKET_MAX_FRAME_SIZE, &u4Complete);
+		UartRxConsume(pCfgInstance, u4Used);
+
+		if(u4Complete != 0U)
+		{
+			u4OutSize = pState->u4FrameSize;
+			u4Overflow = pState->u4Overflow;
+			pState->u4FrameSize = 0U;
+			pState->u4Overflow = 0U;
+
+			if(u4Overflow != 0U)
+			{
+				pState->Stats.u4RxOverflowCount++;
+			}
+			else if(packetCheckFrame(pState, pState->a1Frame, u4OutSize) != 0U)
+			{
+				*ppu1Frame = pState->a1Frame;
+				*pu4Size = u4OutSize - UART_PACKET_CRC_SIZE;
+				return XST_SUCCESS;
+			}
+		}
+	}
+
+	return XST_FAILURE;
+}
+
+ReturnType UartPacketGetStats(uartCfgType *pCfgInstance, uartPacketStatsType *pStats)
+{
+	packetRxStateType *pState = packetGetState(pCfgInstance);
+
+	if((pState == NULL) || (pStats == NULL))
+	{
+		return XST_FAILURE;
+	}
+
+	*pStats = pState->Stats;
+	return XST_SUCCESS;
+}
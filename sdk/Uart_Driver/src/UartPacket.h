@@ -0,0 +1,42 @@
+/*
+ * UartPacket.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_UARTPACKET_H_
+#define SRC_UARTPACKET_H_
+/**************Inclusions******************/
+#include "CommonTypes.h"
+#include "Uart.h"
+/**************Macros******************/
+#define UART_PACKET_MAX_FRAME_SIZE 512U // decoded frame size including CRC, longer frames are dropped
+#define UART_PACKET_CRC_SIZE 2U
+
+/*SLIP special characters - RFC 1055*/
+#define SLIP_END 0xC0U
+#define SLIP_ESC 0xDBU
+#define SLIP_ESC_END 0xDCU
+#define SLIP_ESC_ESC 0xDDU
+/**************Definitions******************/
+/*one piece of a scatter - gather send, pieces are sent back to back as one frame*/
+typedef struct {
+	const RUINT8 *pu1Data;
+	RUINT32 u4Size;
+} uartPacketSegmentType;
+
+typedef struct {
+	RUINT32 u4TxFrameCount;
+	RUINT32 u4RxFrameCount; // frames with valid CRC
+	RUINT32 u4RxCrcErrorCount;
+	RUINT32 u4RxOverflowCount; // frames longer than UART_PACKET_MAX_FRAME_SIZE
+} uartPacketStatsType;
+
+/**************Prototypes******************/
+RUINT16 UartPacketCrc16(RUINT16 u2Crc, const RUINT8 *pu1Data, RUINT32 u4Size);
+ReturnType UartPacketSendV(uartCfgType *pCfgInstance, const uartPacketSegmentType *pSegments, RUINT32 u4NumOfSegments);
+ReturnType UartPacketSend(uartCfgType *pCfgInstance, const RUINT8 *pu1Data, RUINT32 u4Size);
+ReturnType UartPacketReceive(uartCfgType *pCfgInstance, RUINT8 **ppu1Frame, RUINT32 *pu4Size);
+ReturnType UartPacketGetStats(uartCfgType *pCfgInstance, uartPacketStatsType *pStats);
+
+#endif /* SRC_UARTPACKET_H_ */
@@ -52,9 +52,43 @@
 #include "xil_printf.h"
 #include "xscugic.h"
 #include "GIC.h"
+#include "Benchmark.h"
+#include "sleep.h"
+
+static uartCfgType cfgInstance0; // uart 1
+static uartCfgType cfgInstance1; // uart 0
+
+#if GIC_STATIC_VECTOR_TABLE
+/*handler table resolved at link time, GICConnectInterruptHandler calls below only check it*/
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Woverride-init" // entries below replace GIC_VECTOR_TABLE_DEFAULTS on purpose
+const InterruptHandlerType GICStaticVectorTable[GIC_MAX_NUMBER_OF_INTERRUPTS] GIC_VECTOR_TABLE_SECTION = {
+	GIC_VECTOR_TABLE_DEFAULTS,
+#if BENCHMARK_ENABLE
+	[BENCHMARK_GIC_SGI_ID] = { BenchmarkGICHandler, NULL },
+#endif
+	[59] = { (CallbackFunction)xUartPsInterruptHandler, &cfgInstance1 },
+	[82] = { (CallbackFunction)xUartPsInterruptHandler, &cfgInstance0 },
+};
+#pragma GCC diagnostic pop
+#endif
 
-extern RUINT8 a1UartRxArray;
-extern RUINT32 u4ReceivedDataSize;
+/*
+ * echoes received bytes back, runs as deferred work of uart receive interrupt
+ */
+static void UartEchoHandler(void *pArgument)
+{
+	uartCfgType *pCfgInstance = (uartCfgType *)pArgument;
+	RUINT8 a1EchoArray[UART_RX_FIFO_DEPTH];
+	RUINT32 u4ReceivedSize;
+
+	u4ReceivedSize = UartRead(pCfgInstance, a1EchoArray, sizeof(a1EchoArray));
+	while(u4ReceivedSize != 0U)
+	{
+		UartSendData(a1EchoArray, pCfgInstance, u4ReceivedSize);
+		u4ReceivedSize = UartRead(pCfgInstance, a1EchoArray, sizeof(a1EchoArray));
+	}
+}
 
 int main()
 {
@@ -64,23 +98,61 @@ int main()
 
     print("Hello World\n\r");
 
-    uartCfgType cfgInstance0;
-    uartCfgType cfgInstance1;
     GICInstanceType InterruptController;	/* Instance of the Interrupt Controller */
 
     cfgInstance0.DeviceNum = UART_INSTANCE_DEVICE_1;
+    cfgInstance0.BaudRate = UART_BAUDRATE_115200;
+    cfgInstance0.u1RxTriggerLevel = UART_DEFAULT_RX_TRIGGER_LEVEL;
+    cfgInstance0.u1RxTimeout = UART_DEFAULT_RX_TIMEOUT;
+    cfgInstance0.FlowControl = UART_FLOW_CONTROL_NONE; // RTS / CTS are not routed on this board
+    cfgInstance0.u1FlowDelay = UART_DEFAULT_FLOW_DELAY;
     cfgInstance1.DeviceNum = UART_INSTANCE_DEVICE_0;
+    cfgInstance1.BaudRate = UART_BAUDRATE_115200;
+    cfgInstance1.u1RxTriggerLevel = UART_DEFAULT_RX_TRIGGER_LEVEL;
+    cfgInstance1.u1RxTimeout = UART_DEFAULT_RX_TIMEOUT;
+    cfgInstance1.FlowControl = UART_FLOW_CONTROL_NONE; // RTS / CTS are not routed on this board
+    cfgInstance1.u1FlowDelay = UART_DEFAULT_FLOW_DELAY;
 
-    initializeUartCfg (&cfgInstance0);
-    InitializeUart(&cfgInstance0);
+    // both controllers are brought up together and run independently
+    uartCfgType *apCfgInstances[] = { &cfgInstance0, &cfgInstance1 };
+    InitializeUartMulti(apCfgInstances, sizeof(apCfgInstances) / sizeof(apCfgInstances[0]));
 
     //setupGIC(&InterruptController, &cfgInstance0);
 
     (void)InitializeGIC(&InterruptController);
-    (void)GICEnableInterruptID(82);
+    (void)GICEnableInterruptID(82); // uart 1
+    (void)GICEnableInterruptID(59); // uart 0
     GICConnectInterruptHandler(&InterruptController, 82, xUartPsInterruptHandler, &cfgInstance0);
+    GICConnectInterruptHandler(&InterruptController, 59, xUartPsInterruptHandler, &cfgInstance1);
+    UartSetRxCallback(&cfgInstance0, UartEchoHandler, &cfgInstance0);
+    UartSetRxCallback(&cfgInstance1, UartEchoHandler, &cfgInstance1);
     StartGIC();
 
+#if BENCHMARK_ENABLE
+    BenchmarkResultType BenchResult;
+    BenchmarkUartType UartBenchResult;
+    static BenchmarkCacheType aCacheBenchResults[BENCHMARK_CACHE_SIZES];
+    BenchmarkCrossoverType CrossoverResult;
+    static BenchmarkMemType aMemBenchResults[BENCHMARK_MEM_SIZES];
+
+    if(BenchmarkGICDispatch(&InterruptController, &BenchResult) == XST_SUCCESS)
+    {
+    	BenchmarkPrintResult(GIC_STATIC_VECTOR_TABLE ? "gic dispatch, static table" : "gic dispatch, ram table", &BenchResult);
+    }
+    if(BenchmarkUartTx(&cfgInstance0, &UartBenchResult) == XST_SUCCESS)
+    {
+    	BenchmarkPrintUartTx("uart 1 polled tx", &UartBenchResult);
+    }
+    BenchmarkDCacheFlushRange(aCacheBenchResults);
+    BenchmarkPrintDCacheFlushRange(aCacheBenchResults);
+    BenchmarkDCacheCrossover(aCacheBenchResults, &CrossoverResult);
+    BenchmarkPrintDCacheCrossover(&CrossoverResult);
+    BenchmarkMemCpy(aMemBenchResults);
+    BenchmarkPrintMemCpy(aMemBenchResults);
+    BenchmarkMemSet(aMemBenchResults);
+    BenchmarkPrintMemSet(aMemBenchResults);
+#endif
+
     RUINT8 trialArray[] = "hello from my driver \r\n";
     RUINT8 trialArray2[] = "this message is the received \r\n";
 
@@ -91,8 +163,7 @@ int main()
 //    	UartReceiveDataPolling(trialArray2, &cfgInstance0, sizeof(trialArray2));
 //    	UartSendData(trialArray2, &cfgInstance0, sizeof(trialArray2));
 //    	counter++;
-    	/*this is the received message through out 1 second window*/
-    	//UartSendData(a1UartRxArray, &cfgInstance0, u4ReceivedDataSize);
+    	/*received data is echoed back by UartEchoHandler as deferred work of the receive interrupt*/
     }
 
     cleanup_platform();
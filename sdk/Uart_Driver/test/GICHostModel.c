@@ -0,0 +1,547 @@
+/*
+ * GICHostModel.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * Host model of the Zynq MPCore interrupt controller, see GICHostModel.h for what is covered.
+ * GIC.c built with GIC_HOST_MODEL=1 sends every register access here. Only CPU0 is modelled :
+ * SPIs targeted only at CPU1 are never signalled, SGIs sent to CPU1 are dropped.
+ * Interrupt state follows the GIC architecture spec v1 : an ID is inactive, pending, active or
+ * active and pending, the highest priority pending ID that beats the priority mask and the running
+ * priority is signalled, IRQ or FIQ depending on its group and FIQEn. level sensitive IDs are
+ * pending while their line is high, edge triggered IDs latch one pending state per edge.
+ */
+
+/**************Includes******************/
+#include <string.h>
+#include "GICHostModel.h"
+#include "HostCpu.h"
+
+/**************Preprocessor******************/
+#define ICCICR_OFFSET 0x100U
+#define ICCPMR_OFFSET 0x104U
+#define ICCBPR_OFFSET 0x108U
+#define ICCIAR_OFFSET 0x10CU
+#define ICCEOIR_OFFSET 0x110U
+#define ICCRPR_OFFSET 0x114U
+#define ICCHPIR_OFFSET 0x118U
+#define ICCABPR_OFFSET 0x11CU
+#define PTLR_OFFSET 0x600U
+#define PTCNTR_OFFSET 0x604U
+#define PTCTLR_OFFSET 0x608U
+#define PTISR_OFFSET 0x60CU
+#define ICDDCR_OFFSET 0x1000U
+#define ICDICTR_OFFSET 0x1004U
+#define ICDISR_BASE 0x1080U
+#define ICDISER_BASE 0x1100U
+#define ICDICER_BASE 0x1180U
+#define ICDISPR_BASE 0x1200U
+#define ICDICPR_BASE 0x1280U
+#define ICDABR_BASE 0x1300U
+#define ICDIPR_BASE 0x1400U
+#define ICDIPTR_BASE 0x1800U
+#define ICDICFR_BASE 0x1C00U
+#define ICDSGIR_OFFSET 0x1F00U
+#define GIC_MODEL_REGISTER_SPACE 0x2000U
+
+#define ICCICR_ENABLE_S 0x01U
+#define ICCICR_ENABLE_NS 0x02U
+#define ICCICR_ACK_CTL 0x04U
+#define ICCICR_FIQ_EN 0x08U
+#define ICCICR_SBPR 0x10U
+#define ICDDCR_ENABLE_GROUP0 0x01U
+#define ICDDCR_ENABLE_GROUP1 0x02U
+#define PTCTLR_ENABLE 0x01U
+#define PTCTLR_AUTO_RELOAD 0x02U
+#define PTCTLR_IRQ_ENABLE 0x04U
+#define ICDSGIR_SATT 0x8000U
+
+#define GIC_MODEL_NUMBER_OF_SGIS 16U
+#define GIC_MODEL_FIRST_SPI 32U
+#define GIC_MODEL_TIMER_ID 29U
+#define GIC_MODEL_CPU0 0x01U
+#define GIC_MODEL_NO_ID 1023U
+#define GIC_MODEL_GROUP1_NOT_ACKED 1022U
+
+#define MODEL_BIT(ID) (1U << ((ID) % 32U))
+#define MODEL_TEST(Array, ID) (((Array)[(ID) / 32U] & MODEL_BIT(ID)) != 0U)
+
+/**************Definitions******************/
+typedef struct {
+	uint32_t u4Icddcr;
+	uint32_t u4Iccicr;
+	uint32_t u4Iccpmr;
+	uint32_t u4Iccbpr;
+	uint32_t u4Iccabpr;
+	uint32_t au4Enable[GIC_MODEL_WORDS];
+	uint32_t au4Latch[GIC_MODEL_WORDS]; // edge or set pending state
+	uint32_t au4Line[GIC_MODEL_WORDS]; // level of peripheral outputs
+	uint32_t au4Active[GIC_MODEL_WORDS];
+	uint32_t au4Group[GIC_MODEL_WORDS]; // ICDISR, 1 : group 1
+	uint32_t au4Config[GIC_MODEL_NUMBER_OF_IDS / 16U]; // ICDICFR, bit 1 of a field : edge triggered
+	uint8_t au1Priority[GIC_MODEL_NUMBER_OF_IDS];
+	uint8_t au1Target[GIC_MODEL_NUMBER_OF_IDS];
+	uint32_t u4TimerLoad;
+	uint32_t u4TimerCounter;
+	uint32_t u4TimerControl;
+	uint32_t u4TimerStatus;
+	uint32_t au4Other[GIC_MODEL_REGISTER_SPACE / 4U]; // plain storage for registers without behaviour
+	GICHostModelStatsType Stats;
+} GICHostModelType;
+
+static GICHostModelType sModel;
+
+void GICHostModelReset(void)
+{
+	uint32_t u4Index;
+
+	memset(&sModel, 0, sizeof(sModel));
+	// SGIs are always enabled, PPIs and SPIs reset disabled, all IDs group 0 with priority 0
+	sModel.au4Enable[0] = 0x0000FFFFU;
+	sModel.u4Iccbpr = 2U;
+	sModel.u4Iccabpr = 3U;
+	// SGIs edge, PPIs per Cortex-A9 TRM (private timer 29 edge), SPIs reset to level high
+	sModel.au4Config[0] = 0xAAAAAAAAU;
+	sModel.au4Config[1] = 0x7DC00000U;
+	for(u4Index = 2U; u4Index < (GIC_MODEL_NUMBER_OF_IDS / 16U); u4Index++)
+	{
+		sModel.au4Config[u4Index] = 0x55555555U;
+	}
+	for(u4Index = 0U; u4Index < GIC_MODEL_FIRST_SPI; u4Index++)
+	{
+		sModel.au1Target[u4Index] = GIC_MODEL_CPU0;
+	}
+}
+
+static uint32_t modelIsEdge(uint32_t u4ID)
+{
+	return ((sModel.au4Config[u4ID / 16U] >> (((u4ID % 16U) * 2U) + 1U)) & 0x01U);
+}
+
+static uint32_t modelIsPending(uint32_t u4ID)
+{
+	if(MODEL_TEST(sModel.au4Latch, u4ID))
+	{
+		return 1U;
+	}
+	return ((modelIsEdge(u4ID) == 0U) && MODEL_TEST(sModel.au4Line, u4ID)) ? 1U : 0U;
+}
+
+static uint32_t modelGroup(uint32_t u4ID)
+{
+	return MODEL_TEST(sModel.au4Group, u4ID) ? 1U : 0U;
+}
+
+/*group priority of a priority value, binary point of its group decides how many bits take part in preemption*/
+static uint32_t modelGroupPriority(uint32_t u4ID)
+{
+	uint32_t u4BinaryPoint = sModel.u4Iccbpr;
+
+	if((modelGroup(u4ID) != 0U) && ((sModel.u4Iccicr & ICCICR_SBPR) == 0U))
+	{
+		u4BinaryPoint = sModel.u4Iccabpr;
+	}
+	return (uint32_t)sModel.au1Priority[u4ID] & ((0xFFU << (u4BinaryPoint + 1U)) & 0xFFU);
+}
+
+uint32_t GICHostModelRunningPriority(void)
+{
+	uint32_t u4ID;
+	uint32_t u4Running = GIC_MODEL_IDLE_PRIORITY;
+
+	for(u4ID = 0U; u4ID < GIC_MODEL_NUMBER_OF_IDS; u4ID++)
+	{
+		if(MODEL_TEST(sModel.au4Active, u4ID) && (modelGroupPriority(u4ID) < u4Running))
+		{
+			u4Running = modelGroupPriority(u4ID);
+		}
+	}
+	return u4Running;
+}
+
+/*
+ * highest priority ID this CPU interface would signal, GIC_MODEL_NO_ID if none.
+ * equal priorities : lowest ID wins, as in the PL390
+ */
+static uint32_t modelHighestPending(void)
+{
+	uint32_t u4ID;
+	uint32_t u4Best = GIC_MODEL_NO_ID;
+	uint32_t u4Running = GICHostModelRunningPriority();
+	uint32_t u4GroupEnable;
+	uint32_t u4CpuEnable;
+
+	for(u4ID = 0U; u4ID < GIC_MODEL_NUMBER_OF_IDS; u4ID++)
+	{
+		if((modelIsPending(u4ID) == 0U) || MODEL_TEST(sModel.au4Active, u4ID) || !MODEL_TEST(sModel.au4Enable, u4ID) ||
+				((sModel.au1Target[u4ID] & GIC_MODEL_CPU0) == 0U))
+		{
+			continue;
+		}
+		u4GroupEnable = (modelGroup(u4ID) != 0U) ? ICDDCR_ENABLE_GROUP1 : ICDDCR_ENABLE_GROUP0;
+		u4CpuEnable = (modelGroup(u4ID) != 0U) ? ICCICR_ENABLE_NS : ICCICR_ENABLE_S;
+		if(((sModel.u4Icddcr & u4GroupEnable) == 0U) || ((sModel.u4Iccicr & u4CpuEnable) == 0U))
+		{
+			continue;
+		}
+		if(((uint32_t)sModel.au1Priority[u4ID] >= sModel.u4Iccpmr) || (modelGroupPriority(u4ID) >= u4Running))
+		{
+			continue;
+		}
+		if((u4Best == GIC_MODEL_NO_ID) || (sModel.au1Priority[u4ID] < sModel.au1Priority[u4Best]))
+		{
+			u4Best = u4ID;
+		}
+	}
+	return u4Best;
+}
+
+uint32_t GICHostModelFiqLine(void)
+{
+	uint32_t u4ID = modelHighestPending();
+
+	return ((u4ID != GIC_MODEL_NO_ID) && (modelGroup(u4ID) == 0U) && ((sModel.u4Iccicr & ICCICR_FIQ_EN) != 0U)) ? 1U : 0U;
+}
+
+uint32_t GICHostModelIrqLine(void)
+{
+	uint32_t u4ID = modelHighestPending();
+
+	return ((u4ID != GIC_MODEL_NO_ID) && ((modelGroup(u4ID) != 0U) || ((sModel.u4Iccicr & ICCICR_FIQ_EN) == 0U))) ? 1U : 0U;
+}
+
+static uint32_t modelAcknowledge(void)
+{
+	uint32_t u4ID = modelHighestPending();
+
+	if(u4ID == GIC_MODEL_NO_ID)
+	{
+		sModel.Stats.u4SpuriousCount++;
+		return GIC_MODEL_NO_ID;
+	}
+	// secure read with AckCtl clear does not acknowledge group 1 IDs
+	if((modelGroup(u4ID) != 0U) && ((sModel.u4Iccicr & ICCICR_ACK_CTL) == 0U))
+	{
+		sModel.Stats.u4SpuriousCount++;
+		return GIC_MODEL_GROUP1_NOT_ACKED;
+	}
+
+	sModel.au4Latch[u4ID / 32U] &= ~MODEL_BIT(u4ID);
+	sModel.au4Active[u4ID / 32U] |= MODEL_BIT(u4ID);
+	sModel.Stats.u4AckCount++;
+	return u4ID; // source CPU field of SGIs is 0, all SGIs come from CPU0
+}
+
+static void modelEndOfInterrupt(uint32_t u4Value)
+{
+	uint32_t u4ID = u4Value & 0x3FFU;
+
+	if((u4ID >= GIC_MODEL_NUMBER_OF_IDS) || !MODEL_TEST(sModel.au4Active, u4ID))
+	{
+		sModel.Stats.u4EoiErrorCount++;
+		return;
+	}
+	sModel.au4Active[u4ID / 32U] &= ~MODEL_BIT(u4ID);
+	sModel.Stats.u4EoiCount++;
+}
+
+static void modelSendSgi(uint32_t u4Value)
+{
+	uint32_t u4ID = u4Value & 0x0FU;
+	uint32_t u4Filter = (u4Value >> 24) & 0x03U;
+	uint32_t u4Targets = (u4Value >> 16) & 0xFFU;
+
+	if(u4Filter == 1U)
+	{
+		return; // all but the sender, CPU1 is not modelled
+	}
+	if((u4Filter == 2U) || ((u4Targets & GIC_MODEL_CPU0) != 0U))
+	{
+		// secure write forwards the SGI only if SATT matches its group on the target
+		if(modelGroup(u4ID) == (((u4Value & ICDSGIR_SATT) != 0U) ? 1U : 0U))
+		{
+			sModel.au4Latch[0] |= MODEL_BIT(u4ID);
+			sModel.Stats.u4SgiCount++;
+		}
+	}
+}
+
+static uint32_t modelReadBytes(const uint8_t *pu1Bytes, uint32_t u4FirstID)
+{
+	return (uint32_t)pu1Bytes[u4FirstID] | ((uint32_t)pu1Bytes[u4FirstID + 1U] << 8) |
+			((uint32_t)pu1Bytes[u4FirstID + 2U] << 16) | ((uint32_t)pu1Bytes[u4FirstID + 3U] << 24);
+}
+
+uint32_t GICHostModelRead(uint32_t u4Offset)
+{
+	uint32_t u4Word;
+	uint32_t u4Value = 0U;
+	uint32_t u4ID;
+
+	sModel.Stats.u4ReadCount++;
+	HostCpuAdvanceCycles(GIC_MODEL_ACCESS_CYCLES);
+
+	if((u4Offset >= ICDISR_BASE) && (u4Offset < (ICDISR_BASE + (GIC_MODEL_WORDS * 4U))))
+	{
+		return sModel.au4Group[(u4Offset - ICDISR_BASE) / 4U];
+	}
+	if((u4Offset >= ICDISER_BASE) && (u4Offset < (ICDISER_BASE + (GIC_MODEL_WORDS * 4U))))
+	{
+		return sModel.au4Enable[(u4Offset - ICDISER_BASE) / 4U];
+	}
+	if((u4Offset >= ICDICER_BASE) && (u4Offset < (ICDICER_BASE + (GIC_MODEL_WORDS * 4U))))
+	{
+		return sModel.au4Enable[(u4Offset - ICDICER_BASE) / 4U];
+	}
+	if(((u4Offset >= ICDISPR_BASE) && (u4Offset < (ICDISPR_BASE + (GIC_MODEL_WORDS * 4U)))) ||
+			((u4Offset >= ICDICPR_BASE) && (u4Offset < (ICDICPR_BASE + (GIC_MODEL_WORDS * 4U)))))
+	{
+		u4Word = ((u4Offset - ICDISPR_BASE) % 0x80U) / 4U;
+		for(u4ID = u4Word * 32U; u4ID < ((u4Word + 1U) * 32U); u4ID++)
+		{
+			u4Value |= (modelIsPending(u4ID) << (u4ID % 32U));
+		}
+		return u4Value;
+	}
+	if((u4Offset >= ICDABR_BASE) && (u4Offset < (ICDABR_BASE + (GIC_MODEL_WORDS * 4U))))
+	{
+		return sModel.au4Active[(u4Offset - ICDABR_BASE) / 4U];
+	}
+	if((u4Offset >= ICDIPR_BASE) && (u4Offset < (ICDIPR_BASE + GIC_MODEL_NUMBER_OF_IDS)))
+	{
+		return modelReadBytes(sModel.au1Priority, u4Offset - ICDIPR_BASE);
+	}
+	if((u4Offset >= ICDIPTR_BASE) && (u4Offset < (ICDIPTR_BASE + GIC_MODEL_NUMBER_OF_IDS)))
+	{
+		return modelReadBytes(sModel.au1Target, u4Offset - ICDIPTR_BASE);
+	}
+	if((u4Offset >= ICDICFR_BASE) && (u4Offset < (ICDICFR_BASE + ((GIC_MODEL_NUMBER_OF_IDS / 16U) * 4U))))
+	{
+		return sModel.au4Config[(u4Offset - ICDICFR_BASE) / 4U];
+	}
+
+	switch(u4Offset)
+	{
+	case ICDDCR_OFFSET:
+		return sModel.u4Icddcr;
+	case ICDICTR_OFFSET:
+		return 0x00000C02U; // 96 IDs, 2 CPUs, security extensions
+	case ICCICR_OFFSET:
+		return sModel.u4Iccicr;
+	case ICCPMR_OFFSET:
+		return sModel.u4Iccpmr;
+	case ICCBPR_OFFSET:
+		return sModel.u4Iccbpr;
+	case ICCABPR_OFFSET:
+		return sModel.u4Iccabpr;
+	case ICCIAR_OFFSET:
+		u4Value = modelAcknowledge();
+		HostCpuCheckExceptions();
+		return u4Value;
+	case ICCRPR_OFFSET:
+		return (GICHostModelRunningPriority() == GIC_MODEL_IDLE_PRIORITY) ? 0xFFU : GICHostModelRunningPriority();
+	case ICCHPIR_OFFSET:
+		return modelHighestPending();
+	case PTLR_OFFSET:
+		return sModel.u4TimerLoad;
+	case PTCNTR_OFFSET:
+		return sModel.u4TimerCounter;
+	case PTCTLR_OFFSET:
+		return sModel.u4TimerControl;
+	case PTISR_OFFSET:
+		return sModel.u4TimerStatus;
+	default:
+		break;
+	}
+
+	return (u4Offset < GIC_MODEL_REGISTER_SPACE) ? sModel.au4Other[u4Offset / 4U] : 0U;
+}
+
+static void modelWriteBytes(uint8_t *pu1Bytes, uint32_t u4FirstID, uint32_t u4Data, uint8_t u1Mask)
+{
+	uint32_t u4Index;
+
+	for(u4Index = 0U; u4Index < 4U; u4Index++)
+	{
+		pu1Bytes[u4FirstID + u4Index] = (uint8_t)(u4Data >> (u4Index * 8U)) & u1Mask;
+	}
+}
+
+void GICHostModelWrite(uint32_t u4Data, uint32_t u4Offset)
+{
+	uint32_t u4Word;
+
+	sModel.Stats.u4WriteCount++;
+	HostCpuAdvanceCycles(GIC_MODEL_ACCESS_CYCLES);
+
+	if((u4Offset >= ICDISR_BASE) && (u4Offset < (ICDISR_BASE + (GIC_MODEL_WORDS * 4U))))
+	{
+		sModel.au4Group[(u4Offset - ICDISR_BASE) / 4U] = u4Data;
+	}
+	else if((u4Offset >= ICDISER_BASE) && (u4Offset < (ICDISER_BASE + (GIC_MODEL_WORDS * 4U))))
+	{
+		sModel.au4Enable[(u4Offset - ICDISER_BASE) / 4U] |= u4Data;
+	}
+	else if((u4Offset >= ICDICER_BASE) && (u4Offset < (ICDICER_BASE + (GIC_MODEL_WORDS * 4U))))
+	{
+		u4Word = (u4Offset - ICDICER_BASE) / 4U;
+		// SGI enable bits are read only
+		sModel.au4Enable[u4Word] &= ~((u4Word == 0U) ? (u4Data & 0xFFFF0000U) : u4Data);
+	}
+	else if((u4Offset >= ICDISPR_BASE) && (u4Offset < (ICDISPR_BASE + (GIC_MODEL_WORDS * 4U))))
+	{
+		u4Word = (u4Offset - ICDISPR_BASE) / 4U;
+		sModel.au4Latch[u4Word] |= (u4Word == 0U) ? (u4Data & 0xFFFF0000U) : u4Data;
+	}
+	else if((u4Offset >= ICDICPR_BASE) && (u4Offset < (ICDICPR_BASE + (GIC_MODEL_WORDS * 4U))))
+	{
+		// a level ID stays pending while its line is high
+		u4Word = (u4Offset - ICDICPR_BASE) / 4U;
+		sModel.au4Latch[u4Word] &= ~((u4Word == 0U) ? (u4Data & 0xFFFF0000U) : u4Data);
+	}
+	else if((u4Offset >= ICDIPR_BASE) && (u4Offset < (ICDIPR_BASE + GIC_MODEL_NUMBER_OF_IDS)))
+	{
+		modelWriteBytes(sModel.au1Priority, u4Offset - ICDIPR_BASE, u4Data, GIC_MODEL_PRIORITY_BITS);
+	}
+	else if((u4Offset >= ICDIPTR_BASE) && (u4Offset < (ICDIPTR_BASE + GIC_MODEL_NUMBER_OF_IDS)))
+	{
+		// targets of SGIs and PPIs are read only
+		if((u4Offset - ICDIPTR_BASE) >= GIC_MODEL_FIRST_SPI)
+		{
+			modelWriteBytes(sModel.au1Target, u4Offset - ICDIPTR_BASE, u4Data, 0x03U);
+		}
+	}
+	else if((u4Offset >= ICDICFR_BASE) && (u4Offset < (ICDICFR_BASE + ((GIC_MODEL_NUMBER_OF_IDS / 16U) * 4U))))
+	{
+		// SGI and PPI configuration is fixed
+		if((u4Offset - ICDICFR_BASE) >= 8U)
+		{
+			sModel.au4Config[(u4Offset - ICDICFR_BASE) / 4U] = u4Data;
+		}
+	}
+	else
+	{
+		switch(u4Offset)
+		{
+		case ICDDCR_OFFSET:
+			sModel.u4Icddcr = u4Data & (ICDDCR_ENABLE_GROUP0 | ICDDCR_ENABLE_GROUP1);
+			break;
+		case ICCICR_OFFSET:
+			sModel.u4Iccicr = u4Data & 0x1FU;
+			break;
+		case ICCPMR_OFFSET:
+			sModel.u4Iccpmr = u4Data & GIC_MODEL_PRIORITY_BITS;
+			break;
+		case ICCBPR_OFFSET:
+			sModel.u4Iccbpr = u4Data & 0x07U;
+			break;
+		case ICCABPR_OFFSET:
+			sModel.u4Iccabpr = u4Data & 0x07U;
+			break;
+		case ICCEOIR_OFFSET:
+			modelEndOfInterrupt(u4Data);
+			break;
+		case ICDSGIR_OFFSET:
+			modelSendSgi(u4Data);
+			break;
+		case PTLR_OFFSET:
+			sModel.u4TimerLoad = u4Data;
+			sModel.u4TimerCounter = u4Data;
+			break;
+		case PTCNTR_OFFSET:
+			sModel.u4TimerCounter = u4Data;
+			break;
+		case PTCTLR_OFFSET:
+			sModel.u4TimerControl = u4Data;
+			break;
+		case PTISR_OFFSET:
+			sModel.u4TimerStatus &= ~(u4Data & 0x01U);
+			break;
+		default:
+			if(u4Offset < GIC_MODEL_REGISTER_SPACE)
+			{
+				sModel.au4Other[u4Offset / 4U] = u4Data;
+			}
+			break;
+		}
+	}
+
+	HostCpuCheckExceptions();
+}
+
+void GICHostModelSetLine(uint32_t u4ID, uint32_t u4Level)
+{
+	uint32_t u4WasHigh;
+
+	if((u4ID < GIC_MODEL_NUMBER_OF_SGIS) || (u4ID >= GIC_MODEL_NUMBER_OF_IDS))
+	{
+		return;
+	}
+	u4WasHigh = MODEL_TEST(sModel.au4Line, u4ID) ? 1U : 0U;
+	if(u4Level != 0U)
+	{
+		sModel.au4Line[u4ID / 32U] |= MODEL_BIT(u4ID);
+		if((u4WasHigh == 0U) && (modelIsEdge(u4ID) != 0U))
+		{
+			sModel.au4Latch[u4ID / 32U] |= MODEL_BIT(u4ID);
+		}
+	}
+	else
+	{
+		sModel.au4Line[u4ID / 32U] &= ~MODEL_BIT(u4ID);
+	}
+	HostCpuCheckExceptions();
+}
+
+void GICHostModelPulse(uint32_t u4ID)
+{
+	if((u4ID < GIC_MODEL_NUMBER_OF_SGIS) || (u4ID >= GIC_MODEL_NUMBER_OF_IDS))
+	{
+		return;
+	}
+	sModel.au4Latch[u4ID / 32U] |= MODEL_BIT(u4ID);
+	HostCpuCheckExceptions();
+}
+
+/*private timer reached 0 : event flag, interrupt if enabled, reload in auto reload mode*/
+void GICHostModelTimerExpire(void)
+{
+	if((sModel.u4TimerControl & PTCTLR_ENABLE) == 0U)
+	{
+		return;
+	}
+	sModel.u4TimerStatus = 0x01U;
+	sModel.u4TimerCounter = ((sModel.u4TimerControl & PTCTLR_AUTO_RELOAD) != 0U) ? sModel.u4TimerLoad : 0U;
+	if((sModel.u4TimerControl & PTCTLR_AUTO_RELOAD) == 0U)
+	{
+		sModel.u4TimerControl &= ~PTCTLR_ENABLE;
+	}
+	if((sModel.u4TimerControl & PTCTLR_IRQ_ENABLE) != 0U)
+	{
+		sModel.au4Latch[0] |= MODEL_BIT(GIC_MODEL_TIMER_ID);
+	}
+	HostCpuCheckExceptions();
+}
+
+uint32_t GICHostModelIsEnabled(uint32_t u4ID)
+{
+	return MODEL_TEST(sModel.au4Enable, u4ID) ? 1U : 0U;
+}
+
+uint32_t GICHostModelIsPending(uint32_t u4ID)
+{
+	return modelIsPending(u4ID);
+}
+
+uint32_t GICHostModelIsActive(uint32_t u4ID)
+{
+	return MODEL_TEST(sModel.au4Active, u4ID) ? 1U : 0U;
+}
+
+void GICHostModelGetStats(GICHostModelStatsType *pStats)
+{
+	*pStats = sModel.Stats;
+}
@@ -0,0 +1,51 @@
+/*
+ * GICHostModel.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef TEST_GICHOSTMODEL_H_
+#define TEST_GICHOSTMODEL_H_
+/**************Inclusions******************/
+#include <stdint.h>
+/**************Macros******************/
+#define GIC_MODEL_NUMBER_OF_IDS 96U
+#define GIC_MODEL_WORDS ((GIC_MODEL_NUMBER_OF_IDS + 31U) / 32U)
+#define GIC_MODEL_ACCESS_CYCLES 40U // CPU cycles of one MPCore register access, advanced on the CPU model clock
+#define GIC_MODEL_PRIORITY_BITS 0xF8U // 32 priority levels are implemented
+#define GIC_MODEL_IDLE_PRIORITY 0x100U // running priority with nothing active
+
+/**************Definitions******************/
+typedef struct {
+	uint32_t u4AckCount; // ICCIAR reads that returned an interrupt ID
+	uint32_t u4SpuriousCount; // ICCIAR reads that returned 1022 / 1023
+	uint32_t u4EoiCount;
+	uint32_t u4EoiErrorCount; // EOIR writes of an ID that was not active
+	uint32_t u4SgiCount; // ICDSGIR writes that pended an SGI on this CPU
+	uint32_t u4ReadCount;
+	uint32_t u4WriteCount;
+} GICHostModelStatsType;
+
+/**************Prototypes******************/
+/*
+ * model of the PL390 distributor, CPU interface 0 and the private timer of CPU0 as the secure
+ * world sees them. covers what GIC.c uses : enable, pending, active and priority state per ID,
+ * groups (ICDISR) and the ICDDCR / ICCICR group enables, FIQ signalling of group 0 (FIQEn),
+ * ICCPMR, binary point preemption, ICCIAR / ICCEOIR with the running priority, level and edge
+ * sources, SGIs through ICDSGIR and the private timer raising ID 29.
+ */
+void GICHostModelReset(void);
+uint32_t GICHostModelRead(uint32_t u4Offset);
+void GICHostModelWrite(uint32_t u4Data, uint32_t u4Offset);
+void GICHostModelSetLine(uint32_t u4ID, uint32_t u4Level); // level of a peripheral's interrupt output
+void GICHostModelPulse(uint32_t u4ID); // one rising edge of a peripheral's interrupt output
+void GICHostModelTimerExpire(void); // private timer counted down to 0
+uint32_t GICHostModelIrqLine(void);
+uint32_t GICHostModelFiqLine(void);
+uint32_t GICHostModelIsEnabled(uint32_t u4ID);
+uint32_t GICHostModelIsPending(uint32_t u4ID);
+uint32_t GICHostModelIsActive(uint32_t u4ID);
+uint32_t GICHostModelRunningPriority(void);
+void GICHostModelGetStats(GICHostModelStatsType *pStats);
+
+#endif /* TEST_GICHOSTMODEL_H_ */
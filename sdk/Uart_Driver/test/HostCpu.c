@@ -0,0 +1,269 @@
+/*
+ * HostCpu.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * Host model of the CPU side of interrupt handling, stands in for the BSP exception code :
+ * Xil_ExceptionRegisterHandler table, IRQ / FIQ entry that masks the same CPSR bits as the core
+ * and returns to the interrupted CPSR, Xil_EnableNestedInterrupts / Xil_DisableNestedInterrupts,
+ * the PMU cycle counter, MPIDR of the core the code runs as and Xil_SetTlbAttributes. Exceptions
+ * are taken synchronously, an interrupted context continues once the handler returns, which is
+ * what the drivers observe on the target as well.
+ */
+
+/**************Includes******************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "HostCpu.h"
+#include "GICHostModel.h"
+#include "xil_exception.h"
+#include "xil_mmu.h"
+
+/**************Preprocessor******************/
+#define HOST_CPU_NESTED_STACK_SIZE 16U
+#define PMCR_ENABLE_BIT 0x01U
+#define PMCNTEN_CYCLE_BIT 0x80000000U
+#define MPIDR_MP_EXTENSIONS 0x80000000U
+
+/**************Definitions******************/
+typedef struct {
+	Xil_ExceptionHandler Handler;
+	void *pData;
+} HostCpuVectorType;
+
+static volatile uint32_t su4Cpsr = HOST_CPU_RESET_CPSR;
+static HostCpuVectorType sVectors[XIL_EXCEPTION_ID_LAST + 1U];
+static uint32_t sau4NestedStack[HOST_CPU_NESTED_STACK_SIZE]; // CPSR saved by Xil_EnableNestedInterrupts
+static uint32_t su4NestedDepth;
+static uint32_t su4ExceptionDepth;
+static uint32_t su4IrqCount;
+static uint32_t su4FiqCount;
+static uint32_t su4Pmcr;
+static uint32_t su4CountEnable;
+static uint64_t su8Cycles; // modelled time in CPU cycles
+static uint64_t su8CycleCounterBase; // su8Cycles when PMCCNTR was last written / enabled
+static uint32_t su4InCheck;
+static uint32_t su4CpuId;
+static uint32_t su4TlbAttributes;
+
+void HostCpuReset(void)
+{
+	su4Cpsr = HOST_CPU_RESET_CPSR;
+	memset(sVectors, 0, sizeof(sVectors));
+	su4NestedDepth = 0U;
+	su4ExceptionDepth = 0U;
+	su4IrqCount = 0U;
+	su4FiqCount = 0U;
+	su4Pmcr = 0U;
+	su4CountEnable = 0U;
+	su8Cycles = 0U;
+	su8CycleCounterBase = 0U;
+	su4InCheck = 0U;
+	su4CpuId = 0U;
+	su4TlbAttributes = 0U;
+}
+
+void Xil_ExceptionRegisterHandler(u32 Exception_id, Xil_ExceptionHandler Handler, void *Data)
+{
+	if(Exception_id <= XIL_EXCEPTION_ID_LAST)
+	{
+		sVectors[Exception_id].Handler = Handler;
+		sVectors[Exception_id].pData = Data;
+	}
+}
+
+void Xil_SetTlbAttributes(INTPTR Addr, u32 attrib)
+{
+	(void)Addr;
+	su4TlbAttributes = attrib;
+}
+
+void HostCpuSetCpuId(uint32_t u4CpuId)
+{
+	su4CpuId = u4CpuId;
+}
+
+uint32_t HostCpuGetTlbAttributes(void)
+{
+	return su4TlbAttributes;
+}
+
+/*
+ * exception entry and return : mode and mask bits like the core sets them (IRQ : I, FIQ : I and F),
+ * the interrupted CPSR is restored as SPSR would be
+ */
+static void hostCpuTakeException(uint32_t u4ExceptionId, uint32_t u4Mode, uint32_t u4Mask)
+{
+	uint32_t u4SavedCpsr = su4Cpsr;
+	HostCpuVectorType *pVector = &sVectors[u4ExceptionId];
+
+	if(pVector->Handler == NULL)
+	{
+		fprintf(stderr, "HostCpu : exception %u taken without a handler\n", (unsigned)u4ExceptionId);
+		abort();
+	}
+	if(su4ExceptionDepth >= HOST_CPU_MAX_EXCEPTION_DEPTH)
+	{
+		fprintf(stderr, "HostCpu : exception nesting runaway, interrupt source is never cleared\n");
+		abort();
+	}
+
+	su4ExceptionDepth++;
+	su4Cpsr = (su4Cpsr & ~(uint32_t)XREG_CPSR_MODE_BITS) | u4Mode | u4Mask;
+	pVector->Handler(pVector->pData);
+	su4Cpsr = u4SavedCpsr;
+	su4ExceptionDepth--;
+}
+
+/*
+ * takes every exception the GIC model signals and CPSR lets in. FIQ first, it has the higher
+ * priority on the core. a handler can unmask and take further exceptions, which nest here.
+ */
+void HostCpuCheckExceptions(void)
+{
+	uint32_t u4Depth = su4ExceptionDepth;
+
+	// a model write from inside this loop only needs the loop to look again
+	if((su4InCheck & (1U << u4Depth)) != 0U)
+	{
+		return;
+	}
+	su4InCheck |= (1U << u4Depth);
+
+	for(;;)
+	{
+		if(((su4Cpsr & XREG_CPSR_FIQ_ENABLE) == 0U) && (GICHostModelFiqLine() != 0U))
+		{
+			su4FiqCount++;
+			hostCpuTakeException(XIL_EXCEPTION_ID_FIQ_INT, XREG_CPSR_FIQ_MODE, XREG_CPSR_IRQ_ENABLE | XREG_CPSR_FIQ_ENABLE);
+		}
+		else if(((su4Cpsr & XREG_CPSR_IRQ_ENABLE) == 0U) && (GICHostModelIrqLine() != 0U))
+		{
+			su4IrqCount++;
+			hostCpuTakeException(XIL_EXCEPTION_ID_IRQ_INT, XREG_CPSR_IRQ_MODE, XREG_CPSR_IRQ_ENABLE);
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	su4InCheck &= ~(1U << u4Depth);
+}
+
+uint32_t HostCpuGetCpsr(void)
+{
+	return su4Cpsr;
+}
+
+void HostCpuSetCpsr(uint32_t u4Cpsr)
+{
+	su4Cpsr = u4Cpsr;
+	HostCpuCheckExceptions();
+}
+
+/*target macro switches to system mode and clears I and F, the saved CPSR is pushed on the IRQ stack*/
+void HostCpuEnableNestedInterrupts(void)
+{
+	if(su4NestedDepth >= HOST_CPU_NESTED_STACK_SIZE)
+	{
+		fprintf(stderr, "HostCpu : Xil_EnableNestedInterrupts nested too deep\n");
+		abort();
+	}
+	sau4NestedStack[su4NestedDepth++] = su4Cpsr;
+	HostCpuSetCpsr((su4Cpsr & ~(uint32_t)(XREG_CPSR_MODE_BITS | XREG_CPSR_IRQ_ENABLE | XREG_CPSR_FIQ_ENABLE)) |
+			XREG_CPSR_SYSTEM_MODE);
+}
+
+void HostCpuDisableNestedInterrupts(void)
+{
+	if(su4NestedDepth == 0U)
+	{
+		fprintf(stderr, "HostCpu : Xil_DisableNestedInterrupts without Xil_EnableNestedInterrupts\n");
+		abort();
+	}
+	su4Cpsr = sau4NestedStack[--su4NestedDepth];
+}
+
+uint32_t HostCpuReadCp15(const char *pcRegister)
+{
+	if(strcmp(pcRegister, XREG_CP15_PERF_CYCLE_COUNTER) == 0)
+	{
+		if(((su4Pmcr & PMCR_ENABLE_BIT) == 0U) || ((su4CountEnable & PMCNTEN_CYCLE_BIT) == 0U))
+		{
+			return 0U;
+		}
+		return (uint32_t)(su8Cycles - su8CycleCounterBase);
+	}
+	if(strcmp(pcRegister, XREG_CP15_PERF_MONITOR_CTRL) == 0)
+	{
+		return su4Pmcr;
+	}
+	if(strcmp(pcRegister, XREG_CP15_COUNT_ENABLE_SET) == 0)
+	{
+		return su4CountEnable;
+	}
+	if(strcmp(pcRegister, XREG_CP15_MULTI_PROC_AFFINITY) == 0)
+	{
+		return MPIDR_MP_EXTENSIONS | su4CpuId;
+	}
+	return 0U;
+}
+
+void HostCpuWriteCp15(const char *pcRegister, uint32_t u4Value)
+{
+	if(strcmp(pcRegister, XREG_CP15_PERF_MONITOR_CTRL) == 0)
+	{
+		su4Pmcr = u4Value;
+	}
+	else if(strcmp(pcRegister, XREG_CP15_COUNT_ENABLE_SET) == 0)
+	{
+		su4CountEnable |= u4Value;
+	}
+	else if(strcmp(pcRegister, XREG_CP15_COUNT_ENABLE_CLR) == 0)
+	{
+		su4CountEnable &= ~u4Value;
+	}
+}
+
+void HostCpuAdvanceCycles(uint32_t u4Cycles)
+{
+	su8Cycles += u4Cycles;
+}
+
+uint64_t HostCpuGetCycles(void)
+{
+	return su8Cycles;
+}
+
+uint32_t HostCpuGetExceptionDepth(void)
+{
+	return su4ExceptionDepth;
+}
+
+uint32_t HostCpuGetIrqCount(void)
+{
+	return su4IrqCount;
+}
+
+uint32_t HostCpuGetFiqCount(void)
+{
+	return su4FiqCount;
+}
+
+/*BSP delays only advance modelled time, 1 us is 667 CPU cycles*/
+int usleep(unsigned long useconds)
+{
+	su8Cycles += (uint64_t)useconds * 667U;
+	return 0;
+}
+
+unsigned sleep(unsigned int seconds)
+{
+	su8Cycles += (uint64_t)seconds * 666666687U;
+	return 0U;
+}
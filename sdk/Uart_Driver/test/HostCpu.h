@@ -0,0 +1,38 @@
+/*
+ * HostCpu.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef TEST_HOSTCPU_H_
+#define TEST_HOSTCPU_H_
+/**************Inclusions******************/
+#include <stdint.h>
+/**************Macros******************/
+#define HOST_CPU_RESET_CPSR 0xDFU // system mode, IRQ and FIQ masked - state after boot code
+#define HOST_CPU_MAX_EXCEPTION_DEPTH 16U // deeper nesting is reported as a runaway interrupt
+
+/**************Prototypes******************/
+/*
+ * model of the Cortex-A9 core as the drivers see it : CPSR with I / F masks and mode, the IRQ and
+ * FIQ exceptions, the PMU cycle counter and a cycle clock the register models advance.
+ * an exception is taken whenever the GIC model signals it and CPSR does not mask it, i.e. after
+ * every CPSR write and every model state change - same points a real core could take it at.
+ */
+void HostCpuReset(void);
+uint32_t HostCpuGetCpsr(void);
+void HostCpuSetCpsr(uint32_t u4Cpsr);
+uint32_t HostCpuReadCp15(const char *pcRegister);
+void HostCpuWriteCp15(const char *pcRegister, uint32_t u4Value);
+void HostCpuEnableNestedInterrupts(void);
+void HostCpuDisableNestedInterrupts(void);
+void HostCpuCheckExceptions(void);
+void HostCpuAdvanceCycles(uint32_t u4Cycles);
+uint64_t HostCpuGetCycles(void);
+uint32_t HostCpuGetExceptionDepth(void);
+uint32_t HostCpuGetIrqCount(void);
+uint32_t HostCpuGetFiqCount(void);
+void HostCpuSetCpuId(uint32_t u4CpuId); // core the calling code runs as, reported by MPIDR. exceptions are CPU0's
+uint32_t HostCpuGetTlbAttributes(void); // attributes of the last Xil_SetTlbAttributes call, 0 if none
+
+#endif /* TEST_HOSTCPU_H_ */
@@ -0,0 +1,139 @@
+/*
+ * TestBenchmark.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * Benchmark.c against the GIC and uart models, built with the RAM vector table and with GIC_STATIC_VECTOR_TABLE=1.
+ * the CPU model charges nothing for the code between register accesses, so the RAM and the static table cost the
+ * same here : BenchmarkGICDispatch is only checked for collecting every sample in both dispatch modes, its cycles
+ * are not printed. the numbers of the comparison come from main.c on the board. uart model times the fifo and the
+ * line to the cycle, polled TX throughput is reported against line rate at 115200 and 921600 next to the old wait
+ * for empty per byte loop.
+ */
+
+/**************Includes******************/
+#include <string.h>
+#include "TestCommon.h"
+#include "HostCpu.h"
+#include "GICHostModel.h"
+#include "UartHostModel.h"
+#include "GIC.h"
+#include "Uart.h"
+#include "Benchmark.h"
+#include "xparameters.h"
+
+/**************Preprocessor******************/
+#define TEST_UART_DEVICE 1U
+#define TEST_UART_BASE 0xE0001000U
+#define TEST_UART_FIFO (TEST_UART_BASE + 0x30U)
+#define TEST_UART_SR (TEST_UART_BASE + 0x2CU)
+#define TEST_UART_SR_TXEMPTY 0x0008U
+#define TEST_UART_SR_TACTIVE 0x0800U
+#define TEST_MIN_PERMILLE 995U // burst fill loses less than half a percent to start up
+#define TEST_MAX_PERMILLE 1001U
+
+/**************Definitions******************/
+static GICInstanceType sGic;
+static uartCfgType sUartCfg;
+
+#if GIC_STATIC_VECTOR_TABLE
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Woverride-init"
+const InterruptHandlerType GICStaticVectorTable[GIC_MAX_NUMBER_OF_INTERRUPTS] GIC_VECTOR_TABLE_SECTION = {
+	GIC_VECTOR_TABLE_DEFAULTS,
+	[BENCHMARK_GIC_SGI_ID] = { BenchmarkGICHandler, NULL },
+};
+#pragma GCC diagnostic pop
+#endif
+
+/*measurement loop only, see above*/
+static void TestGICDispatchLoop(void)
+{
+	BenchmarkResultType Result;
+
+	HostCpuReset();
+	GICHostModelReset();
+	TEST_ASSERT(InitializeGIC(&sGic) == GIC_SUCCESS);
+	StartGIC();
+
+	TEST_ASSERT(BenchmarkGICDispatch(NULL, &Result) == XST_FAILURE);
+	TEST_ASSERT(BenchmarkGICDispatch(&sGic, &Result) == XST_SUCCESS);
+	TEST_ASSERT(Result.u4Count == BENCHMARK_GIC_ITERATIONS);
+	TEST_ASSERT(Result.u4MinCycles != 0U);
+	TEST_ASSERT(Result.u4MinCycles <= Result.u4MaxCycles);
+	TEST_ASSERT(sGic.u4DispatchCount == BENCHMARK_GIC_ITERATIONS);
+}
+
+/*TX loop before burst fill : one byte, then wait for the fifo to run empty*/
+static RUINT32 testPerByteBytesPerSecond(RUINT32 u4Size)
+{
+	uint64_t u8Start = HostCpuGetCycles();
+	RUINT32 u4Index;
+
+	for(u4Index = 0U; u4Index < u4Size; u4Index++)
+	{
+		UartHostModelWrite(TEST_UART_FIFO, 'a' + (u4Index % 26U));
+		while((UartHostModelRead(TEST_UART_SR) & TEST_UART_SR_TXEMPTY) == 0U)
+		{
+		}
+	}
+	while((UartHostModelRead(TEST_UART_SR) & TEST_UART_SR_TACTIVE) != 0U)
+	{
+	}
+
+	return (RUINT32)(((uint64_t)u4Size * XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ) / (HostCpuGetCycles() - u8Start));
+}
+
+static void testUartThroughput(RUINT32 u4BaudRate)
+{
+	BenchmarkUartType Result;
+	RUINT32 u4PerByte;
+	const uint8_t *pu1Wire;
+	RUINT32 u4WireBefore;
+
+	HostCpuReset();
+	GICHostModelReset();
+	UartHostModelReset();
+	memset(&sUartCfg, 0, sizeof(sUartCfg));
+	sUartCfg.DeviceNum = UART_INSTANCE_DEVICE_1;
+	sUartCfg.BaudRate = (uartBaudRateType)u4BaudRate;
+	sUartCfg.Parity = UART_PARITY_NONE;
+	sUartCfg.FlowControl = UART_FLOW_CONTROL_NONE;
+	TEST_ASSERT(InitializeUart(&sUartCfg) == XST_SUCCESS);
+
+	TEST_ASSERT(BenchmarkUartTx(NULL, &Result) == XST_FAILURE);
+	TEST_ASSERT(UartTxWaitIdle(NULL) == XST_FAILURE);
+	// trial message of InitializeUart is still on the line
+	TEST_ASSERT(UartTxWaitIdle(&sUartCfg) == XST_SUCCESS);
+	TEST_ASSERT(UartHostModelTxBusy(TEST_UART_DEVICE) == 0U);
+	u4WireBefore = UartHostModelGetWire(TEST_UART_DEVICE, &pu1Wire);
+	TEST_ASSERT(BenchmarkUartTx(&sUartCfg, &Result) == XST_SUCCESS);
+	TEST_ASSERT(UartHostModelGetWire(TEST_UART_DEVICE, &pu1Wire) == (u4WireBefore + BENCHMARK_UART_TX_SIZE));
+	TEST_ASSERT(UartHostModelTxBusy(TEST_UART_DEVICE) == 0U);
+	// model truncates the bit time to whole CPU cycles, a bit faster than the exact rate
+	TEST_ASSERT(((uint64_t)Result.u4BytesPerSecond * 1000U) <= ((uint64_t)Result.u4LineBytesPerSecond * TEST_MAX_PERMILLE));
+	TEST_ASSERT(((uint64_t)Result.u4BytesPerSecond * 1000U) >= ((uint64_t)Result.u4LineBytesPerSecond * TEST_MIN_PERMILLE));
+	BenchmarkPrintUartTx((u4BaudRate == 115200U) ? "  burst fill, 115200" : "  burst fill, 921600", &Result);
+
+	// TXEMPTY only covers the fifo, shift register still holds a character when it is set. the old loop keeps up
+	// as long as the CPU comes back within one character time, burst fill rides out 64 character times
+	u4PerByte = testPerByteBytesPerSecond(BENCHMARK_UART_TX_SIZE / 8U);
+	TEST_ASSERT(((uint64_t)u4PerByte * 1000U) <= ((uint64_t)Result.u4BytesPerSecond * TEST_MAX_PERMILLE));
+	printf("  wait for empty per byte : %u bytes/s of %u line rate\n", u4PerByte, Result.u4LineBytesPerSecond);
+}
+
+static void TestUartThroughput(void)
+{
+	testUartThroughput(115200U);
+	testUartThroughput(921600U);
+}
+
+int main(void)
+{
+	TEST_RUN(TestGICDispatchLoop);
+	TEST_RUN(TestUartThroughput);
+	return TEST_RESULT();
+}
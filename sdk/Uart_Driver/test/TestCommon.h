@@ -0,0 +1,35 @@
+/*
+ * TestCommon.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef TEST_TESTCOMMON_H_
+#define TEST_TESTCOMMON_H_
+/**************Inclusions******************/
+#include <stdio.h>
+/**************Macros******************/
+/*
+ * minimal host test helpers, a test program returns the number of failed checks.
+ * TEST_ASSERT keeps going after a failure so one run reports every broken check.
+ */
+#define TEST_ASSERT(Condition) \
+	do { \
+		if(!(Condition)) { \
+			printf("  FAIL %s:%d : %s\n", __FILE__, __LINE__, #Condition); \
+			su4TestFailures++; \
+		} \
+	} while(0)
+
+#define TEST_RUN(TestFunction) \
+	do { \
+		unsigned int u4FailuresBefore = su4TestFailures; \
+		TestFunction(); \
+		printf("%s %s\n", (su4TestFailures == u4FailuresBefore) ? "PASS" : "FAIL", #TestFunction); \
+	} while(0)
+
+#define TEST_RESULT() ((su4TestFailures == 0U) ? 0 : 1)
+
+static unsigned int su4TestFailures;
+
+#endif /* TEST_TESTCOMMON_H_ */
@@ -0,0 +1,440 @@
+/*
+ * TestGIC.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * GIC.c against the distributor / CPU interface model : dispatch, tail chaining, nesting by
+ * priority, deferred work, SGIs, the interrupt storm limiter and secondary core bring up.
+ */
+
+/**************Includes******************/
+#include <string.h>
+#include "TestCommon.h"
+#include "HostCpu.h"
+#include "GICHostModel.h"
+#include "GIC.h"
+#include "xil_exception.h"
+
+/**************Preprocessor******************/
+#define TEST_LOG_SIZE 64U
+#define TEST_ID_LOW 40U
+#define TEST_ID_HIGH 41U
+#define TEST_ID_EQUAL 42U
+#define TEST_STORM_ID 61U
+#define TEST_QUIET_ID 62U
+#define TEST_SGI_ID 3U
+#define TEST_FIQ_ID 45U
+#define TEST_LOG_END 0x100U // added to an ID when its handler returns
+#define TEST_SPI_PRIORITY 0x30U
+#define TEST_ICDDCR 0x1000U
+#define TEST_ICDIPR(x) (0x1400U + ((x) & ~3U))
+#define TEST_ICCICR 0x100U
+#define TEST_ICCPMR 0x104U
+
+/**************Definitions******************/
+typedef struct {
+	RUINT32 au4Entries[TEST_LOG_SIZE];
+	RUINT32 u4Count;
+} TestLogType;
+
+static GICInstanceType sGic;
+static TestLogType sLog;
+static RUINT32 su4ExceptionDepthSeen[GIC_MAX_NUMBER_OF_INTERRUPTS];
+static RUINT32 su4StormEvents;
+
+static void testLog(RUINT32 u4Value)
+{
+	if(sLog.u4Count < TEST_LOG_SIZE)
+	{
+		sLog.au4Entries[sLog.u4Count++] = u4Value;
+	}
+}
+
+static void testSetUp(void)
+{
+	HostCpuReset();
+	GICHostModelReset();
+	memset(&sLog, 0, sizeof(sLog));
+	memset(su4ExceptionDepthSeen, 0, sizeof(su4ExceptionDepthSeen));
+	TEST_ASSERT(InitializeGIC(&sGic) == GIC_SUCCESS);
+	StartGIC();
+}
+
+/*handler argument is the ID, logs entry and exit*/
+static void testLogHandler(void *pArgument)
+{
+	RUINT32 u4ID = (RUINT32)(UINTPTR)pArgument;
+
+	su4ExceptionDepthSeen[u4ID] = HostCpuGetExceptionDepth();
+	testLog(u4ID);
+	testLog(u4ID + TEST_LOG_END);
+}
+
+/*lower priority handler that raises a higher and an equal priority interrupt while it runs*/
+static void testPreemptedHandler(void *pArgument)
+{
+	RUINT32 u4ID = (RUINT32)(UINTPTR)pArgument;
+
+	testLog(u4ID);
+	GICHostModelPulse(TEST_ID_HIGH);
+	GICHostModelPulse(TEST_ID_EQUAL);
+	testLog(u4ID + TEST_LOG_END);
+}
+
+static void testConnect(RUINT32 u4ID, CallbackFunction Handler, RUINT8 u1Priority)
+{
+	TEST_ASSERT(GICConnectInterruptHandler(&sGic, u4ID, Handler, (void *)(UINTPTR)u4ID) == GIC_SUCCESS);
+	TEST_ASSERT(GICSetInterruptPriority(u4ID, u1Priority) == GIC_SUCCESS);
+	TEST_ASSERT(GICEnableInterruptID(u4ID) == GIC_SUCCESS);
+}
+
+static void TestDispatch(void)
+{
+	GICHostModelStatsType Stats;
+
+	testSetUp();
+	testConnect(TEST_ID_LOW, testLogHandler, GIC_DEFAULT_PRIORITY);
+
+	GICHostModelPulse(TEST_ID_LOW);
+
+	TEST_ASSERT(sLog.u4Count == 2U);
+	TEST_ASSERT(sLog.au4Entries[0] == TEST_ID_LOW);
+	TEST_ASSERT(su4ExceptionDepthSeen[TEST_ID_LOW] == 1U);
+	TEST_ASSERT(sGic.u4ExceptionCount == 1U);
+	TEST_ASSERT(sGic.u4DispatchCount == 1U);
+	TEST_ASSERT(sGic.u4SpuriousCount == 0U);
+	TEST_ASSERT(GICHostModelIsActive(TEST_ID_LOW) == 0U);
+	TEST_ASSERT(GICHostModelIsPending(TEST_ID_LOW) == 0U);
+	GICHostModelGetStats(&Stats);
+	TEST_ASSERT(Stats.u4EoiErrorCount == 0U);
+	TEST_ASSERT(Stats.u4EoiCount == 1U);
+	TEST_ASSERT(HostCpuGetExceptionDepth() == 0U);
+
+	// disabled ID stays pending and is not signalled
+	GICHostModelPulse(TEST_ID_EQUAL);
+	TEST_ASSERT(sLog.u4Count == 2U);
+	TEST_ASSERT(GICHostModelIsPending(TEST_ID_EQUAL) == 1U);
+
+	// priority at the priority mask is never signalled
+	GICHostModelWrite(0U, 0x1280U + 4U); // clear pending of 32 - 63
+	testConnect(TEST_ID_EQUAL, testLogHandler, GIC_DEFAULT_PRIORITY);
+	TEST_ASSERT(GICSetInterruptPriority(TEST_ID_EQUAL, 0xF0U) == GIC_FAILURE);
+}
+
+/*IDs pending when the exception is taken are dispatched in one exception, highest priority first*/
+static void TestTailChain(void)
+{
+	testSetUp();
+	testConnect(TEST_ID_LOW, testLogHandler, 0xA0U);
+	testConnect(TEST_ID_HIGH, testLogHandler, 0x90U);
+	testConnect(TEST_ID_EQUAL, testLogHandler, 0xA0U);
+
+	Xil_ExceptionDisable();
+	GICHostModelPulse(TEST_ID_EQUAL);
+	GICHostModelPulse(TEST_ID_LOW);
+	GICHostModelPulse(TEST_ID_HIGH);
+	TEST_ASSERT(sLog.u4Count == 0U);
+	Xil_ExceptionEnable();
+
+	TEST_ASSERT(HostCpuGetIrqCount() == 1U);
+	TEST_ASSERT(sGic.u4ExceptionCount == 1U);
+	TEST_ASSERT(sGic.u4DispatchCount == 3U);
+	TEST_ASSERT(sLog.u4Count == 6U);
+	TEST_ASSERT(sLog.au4Entries[0] == TEST_ID_HIGH);
+	TEST_ASSERT(sLog.au4Entries[2] == TEST_ID_LOW); // equal priority : lower ID first
+	TEST_ASSERT(sLog.au4Entries[4] == TEST_ID_EQUAL);
+}
+
+/*
+ * nested mode : a higher priority ID preempts the running handler, an equal priority one waits for its EOI.
+ * without nested mode both wait.
+ */
+static void TestNesting(void)
+{
+#if GIC_PROFILE_ENABLE
+	GICProfileType Profile;
+#endif
+
+	testSetUp();
+	testConnect(TEST_ID_LOW, testPreemptedHandler, 0xA0U);
+	testConnect(TEST_ID_HIGH, testLogHandler, 0x80U);
+	testConnect(TEST_ID_EQUAL, testLogHandler, 0xA0U);
+	TEST_ASSERT(GICSetNestedMode(&sGic, 1U) == GIC_SUCCESS);
+
+	GICHostModelPulse(TEST_ID_LOW);
+
+	TEST_ASSERT(sLog.u4Count == 6U);
+	TEST_ASSERT(sLog.au4Entries[0] == TEST_ID_LOW);
+	TEST_ASSERT(sLog.au4Entries[1] == TEST_ID_HIGH);
+	TEST_ASSERT(sLog.au4Entries[2] == (TEST_ID_HIGH + TEST_LOG_END));
+	TEST_ASSERT(sLog.au4Entries[3] == (TEST_ID_LOW + TEST_LOG_END));
+	TEST_ASSERT(sLog.au4Entries[4] == TEST_ID_EQUAL);
+	TEST_ASSERT(su4ExceptionDepthSeen[TEST_ID_HIGH] == 2U);
+	TEST_ASSERT(su4ExceptionDepthSeen[TEST_ID_EQUAL] == 1U);
+	TEST_ASSERT(sGic.u4ExceptionCount == 2U);
+	TEST_ASSERT(sGic.u4DispatchCount == 3U);
+	TEST_ASSERT((HostCpuGetCpsr() & XIL_EXCEPTION_ALL) == XIL_EXCEPTION_FIQ); // back to thread mode state
+#if GIC_PROFILE_ENABLE
+	TEST_ASSERT(GICGetProfile(&Profile) == GIC_SUCCESS);
+	TEST_ASSERT(Profile.u4MaxNestingDepth == 2U);
+	TEST_ASSERT(Profile.Entries[TEST_ID_LOW].u4Count == 1U);
+	// run time of the preempted handler includes the nested one
+	TEST_ASSERT(Profile.Entries[TEST_ID_LOW].u4MaxRunCycles > Profile.Entries[TEST_ID_HIGH].u4MaxRunCycles);
+#endif
+
+	memset(&sLog, 0, sizeof(sLog));
+	TEST_ASSERT(GICSetNestedMode(&sGic, 0U) == GIC_SUCCESS);
+	GICHostModelPulse(TEST_ID_LOW);
+
+	TEST_ASSERT(sLog.u4Count == 6U);
+	TEST_ASSERT(sLog.au4Entries[1] == (TEST_ID_LOW + TEST_LOG_END));
+	TEST_ASSERT(sLog.au4Entries[2] == TEST_ID_HIGH);
+	TEST_ASSERT(sLog.au4Entries[4] == TEST_ID_EQUAL);
+	TEST_ASSERT(su4ExceptionDepthSeen[TEST_ID_HIGH] == 1U);
+}
+
+static RUINT32 su4WorkActive;
+static RUINT32 su4WorkCpsr;
+static RUINT32 su4WorkCount;
+
+static void testDeferredWork(void *pArgument)
+{
+	su4WorkActive = GICHostModelIsActive((RUINT32)(UINTPTR)pArgument);
+	su4WorkCpsr = HostCpuGetCpsr();
+	su4WorkCount++;
+}
+
+static void testPostingHandler(void *pArgument)
+{
+	testLog((RUINT32)(UINTPTR)pArgument);
+	TEST_ASSERT(GICPostDeferredWork(testDeferredWork, pArgument) == GIC_SUCCESS);
+}
+
+/*deferred work runs after the EOI of its interrupt, with IRQs enabled*/
+static void TestDeferredWork(void)
+{
+	testSetUp();
+	testConnect(TEST_ID_LOW, testPostingHandler, GIC_DEFAULT_PRIORITY);
+	su4WorkCount = 0U;
+
+	GICHostModelPulse(TEST_ID_LOW);
+
+	TEST_ASSERT(su4WorkCount == 1U);
+	TEST_ASSERT(su4WorkActive == 0U);
+	TEST_ASSERT((su4WorkCpsr & XIL_EXCEPTION_IRQ) == 0U);
+	TEST_ASSERT(GICPostDeferredWork(NULL, NULL) == GIC_FAILURE);
+}
+
+static void TestSoftwareInterrupt(void)
+{
+	GICHostModelStatsType Stats;
+
+	testSetUp();
+	testConnect(TEST_SGI_ID, testLogHandler, GIC_DEFAULT_PRIORITY);
+
+	TEST_ASSERT(GICSendSoftwareInterrupt(TEST_SGI_ID, GIC_CPU0_MASK) == GIC_SUCCESS);
+	TEST_ASSERT(sLog.u4Count == 2U);
+	TEST_ASSERT(sLog.au4Entries[0] == TEST_SGI_ID);
+
+	// CPU1 only : not signalled here
+	TEST_ASSERT(GICSendSoftwareInterrupt(TEST_SGI_ID, GIC_CPU1_MASK) == GIC_SUCCESS);
+	TEST_ASSERT(sLog.u4Count == 2U);
+	TEST_ASSERT(GICSendSoftwareInterrupt(GIC_NUMBER_OF_SGIS, GIC_CPU0_MASK) == GIC_FAILURE);
+	TEST_ASSERT(GICSendSoftwareInterrupt(TEST_SGI_ID, 0U) == GIC_FAILURE);
+	GICHostModelGetStats(&Stats);
+	TEST_ASSERT(Stats.u4SgiCount == 1U);
+}
+
+#if GIC_RATE_LIMIT_ENABLE
+static RUINT32 su4StormCalls;
+static RUINT32 su4QuietCalls;
+
+/*level source that needs one handler call per event, line drops when every event was handled*/
+static void testStormHandler(void *pArgument)
+{
+	(void)pArgument;
+	su4StormCalls++;
+	if(su4StormEvents != 0U)
+	{
+		su4StormEvents--;
+	}
+	if(su4StormEvents == 0U)
+	{
+		GICHostModelSetLine(TEST_STORM_ID, 0U);
+	}
+}
+
+static void testQuietHandler(void *pArgument)
+{
+	(void)pArgument;
+	su4QuietCalls++;
+}
+
+/*
+ * a level source that keeps its line high is masked after its limit and served by the poll timer,
+ * other IDs are still dispatched, the source is unmasked after GIC_RATE_LIMIT_QUIET_TICKS idle ticks
+ */
+static void TestStormLimiter(void)
+{
+	GICRateLimitType RateLimit;
+	RUINT32 u4Tick;
+
+	testSetUp();
+	su4StormCalls = 0U;
+	su4QuietCalls = 0U;
+	TEST_ASSERT(GICStartPollTimer(&sGic, 1000U) == GIC_SUCCESS);
+	testConnect(TEST_STORM_ID, testStormHandler, GIC_DEFAULT_PRIORITY);
+	testConnect(TEST_QUIET_ID, testQuietHandler, GIC_DEFAULT_PRIORITY);
+	TEST_ASSERT(GICSetRateLimit(TEST_STORM_ID, 4U) == GIC_SUCCESS);
+	TEST_ASSERT(GICSetRateLimit(GIC_POLL_TIMER_ID, 4U) == GIC_FAILURE);
+
+	su4StormEvents = 20U;
+	GICHostModelSetLine(TEST_STORM_ID, 1U);
+
+	// limit + 1 dispatches, then masked
+	TEST_ASSERT(su4StormCalls == 5U);
+	TEST_ASSERT(GICHostModelIsEnabled(TEST_STORM_ID) == 0U);
+	TEST_ASSERT(GICHostModelIsPending(TEST_STORM_ID) == 1U);
+	TEST_ASSERT(HostCpuGetExceptionDepth() == 0U);
+	TEST_ASSERT(GICGetRateLimit(TEST_STORM_ID, &RateLimit) == GIC_SUCCESS);
+	TEST_ASSERT(RateLimit.u4Polling == 1U);
+	TEST_ASSERT(RateLimit.u4StormCount == 1U);
+
+	// storm does not hold off other sources
+	GICHostModelPulse(TEST_QUIET_ID);
+	TEST_ASSERT(su4QuietCalls == 1U);
+
+	// one handler call per tick while the source is pending
+	for(u4Tick = 0U; u4Tick < 15U; u4Tick++)
+	{
+		GICHostModelTimerExpire();
+	}
+	TEST_ASSERT(su4StormCalls == 20U);
+	TEST_ASSERT(su4StormEvents == 0U);
+	TEST_ASSERT(GICHostModelIsEnabled(TEST_STORM_ID) == 0U);
+
+	GICHostModelTimerExpire();
+	TEST_ASSERT(GICHostModelIsEnabled(TEST_STORM_ID) == 0U);
+	GICHostModelTimerExpire();
+	TEST_ASSERT(GICHostModelIsEnabled(TEST_STORM_ID) == 1U);
+
+	TEST_ASSERT(GICGetRateLimit(TEST_STORM_ID, &RateLimit) == GIC_SUCCESS);
+	TEST_ASSERT(RateLimit.u4Polling == 0U);
+	TEST_ASSERT(RateLimit.u4PollCount == 15U);
+	TEST_ASSERT(su4StormCalls == 20U);
+
+	// short burst within the limit is dispatched normally
+	su4StormEvents = 3U;
+	GICHostModelSetLine(TEST_STORM_ID, 1U);
+	TEST_ASSERT(su4StormCalls == 23U);
+	TEST_ASSERT(GICHostModelIsEnabled(TEST_STORM_ID) == 1U);
+
+	TEST_ASSERT(GICSetRateLimit(TEST_STORM_ID, 0U) == GIC_SUCCESS);
+}
+#endif
+
+static RUINT32 su4FiqCpsr;
+
+static void testFiqHandler(void *pArgument)
+{
+	su4FiqCpsr = HostCpuGetCpsr();
+	testLogHandler(pArgument);
+}
+
+/*IRQ handler that raises the FIQ source while it runs*/
+static void testFiqRaisingHandler(void *pArgument)
+{
+	RUINT32 u4ID = (RUINT32)(UINTPTR)pArgument;
+
+	testLog(u4ID);
+	GICHostModelPulse(TEST_FIQ_ID);
+	testLog(u4ID + TEST_LOG_END);
+}
+
+/*
+ * one ID on FIQ, every other ID group 1 : ordinary IRQs and SGIs are still dispatched, the FIQ ID
+ * preempts a running IRQ handler. runs last, the FIQ ID cannot be given back.
+ */
+static void TestFiqCoexistence(void)
+{
+	testSetUp();
+	testConnect(TEST_ID_LOW, testLogHandler, GIC_DEFAULT_PRIORITY);
+	testConnect(TEST_ID_HIGH, testFiqRaisingHandler, GIC_DEFAULT_PRIORITY);
+	testConnect(TEST_SGI_ID, testLogHandler, GIC_DEFAULT_PRIORITY);
+	TEST_ASSERT(GICConnectFiqHandler(&sGic, TEST_FIQ_ID, testFiqHandler, (void *)(UINTPTR)TEST_FIQ_ID) == GIC_SUCCESS);
+	TEST_ASSERT(GICEnableInterruptID(TEST_FIQ_ID) == GIC_SUCCESS);
+	TEST_ASSERT(GICConnectFiqHandler(&sGic, TEST_ID_LOW, testFiqHandler, NULL) == GIC_FAILURE);
+
+	GICHostModelPulse(TEST_FIQ_ID);
+	TEST_ASSERT(HostCpuGetFiqCount() == 1U);
+	TEST_ASSERT(sGic.u4FiqCount == 1U);
+	TEST_ASSERT(sLog.au4Entries[0] == TEST_FIQ_ID);
+	TEST_ASSERT((su4FiqCpsr & XIL_EXCEPTION_ALL) == XIL_EXCEPTION_ALL);
+	TEST_ASSERT(GICHostModelIsActive(TEST_FIQ_ID) == 0U);
+
+	// group 1 IDs are signalled as IRQ
+	memset(&sLog, 0, sizeof(sLog));
+	GICHostModelPulse(TEST_ID_LOW);
+	TEST_ASSERT(HostCpuGetIrqCount() == 1U);
+	TEST_ASSERT(sLog.u4Count == 2U);
+	TEST_ASSERT(sLog.au4Entries[0] == TEST_ID_LOW);
+	TEST_ASSERT(GICSendSoftwareInterrupt(TEST_SGI_ID, GIC_CPU0_MASK) == GIC_SUCCESS);
+	TEST_ASSERT(sLog.u4Count == 4U);
+	TEST_ASSERT(sLog.au4Entries[2] == TEST_SGI_ID);
+
+	// FIQ is taken inside the IRQ handler, without nested mode
+	memset(&sLog, 0, sizeof(sLog));
+	GICHostModelPulse(TEST_ID_HIGH);
+	TEST_ASSERT(sLog.u4Count == 4U);
+	TEST_ASSERT(sLog.au4Entries[1] == TEST_FIQ_ID);
+	TEST_ASSERT(sLog.au4Entries[3] == (TEST_ID_HIGH + TEST_LOG_END));
+	TEST_ASSERT(su4ExceptionDepthSeen[TEST_FIQ_ID] == 2U);
+	TEST_ASSERT(sGic.u4FiqCount == 2U);
+}
+
+/*
+ * secondary core bring up : CPU0 ran InitializeGIC / StartGIC, the CPU interface and banked SGI / PPI
+ * priorities are still at reset as CPU1 sees them. InitializeGICCpuInterface must not touch shared state.
+ */
+static void TestCpuInterfaceOnly(void)
+{
+	RUINT32 u4Icddcr;
+
+	testSetUp();
+	TEST_ASSERT(GICSetInterruptPriority(TEST_ID_LOW, TEST_SPI_PRIORITY) == GIC_SUCCESS);
+	u4Icddcr = GICHostModelRead(TEST_ICDDCR);
+	GICHostModelWrite(0U, TEST_ICCICR);
+	GICHostModelWrite(0U, TEST_ICCPMR);
+	GICHostModelWrite(0U, TEST_ICDIPR(TEST_SGI_ID));
+
+	TEST_ASSERT(InitializeGICCpuInterface(NULL) == GIC_FAILURE);
+	TEST_ASSERT(InitializeGICCpuInterface(&sGic) == GIC_SUCCESS);
+	TEST_ASSERT(GICHostModelRead(TEST_ICDDCR) == u4Icddcr);
+	TEST_ASSERT(((GICHostModelRead(TEST_ICDIPR(TEST_ID_LOW)) >> ((TEST_ID_LOW % 4U) * 8U)) & 0xFFU) == TEST_SPI_PRIORITY);
+	TEST_ASSERT(GICHostModelRead(TEST_ICDIPR(TEST_SGI_ID)) == (GIC_DEFAULT_PRIORITY * 0x01010101U));
+	TEST_ASSERT(GICHostModelRead(TEST_ICCPMR) != 0U);
+
+	// SGI from CPU0 reaches the handler connected on this core
+	TEST_ASSERT(GICConnectInterruptHandler(&sGic, TEST_SGI_ID, testLogHandler, (void *)(UINTPTR)TEST_SGI_ID) == GIC_SUCCESS);
+	TEST_ASSERT(GICSendSoftwareInterrupt(TEST_SGI_ID, GIC_CPU0_MASK) == GIC_SUCCESS);
+	TEST_ASSERT(sLog.u4Count == 2U);
+	TEST_ASSERT(sLog.au4Entries[0] == TEST_SGI_ID);
+}
+
+int main(void)
+{
+	TEST_RUN(TestDispatch);
+	TEST_RUN(TestTailChain);
+	TEST_RUN(TestNesting);
+	TEST_RUN(TestDeferredWork);
+	TEST_RUN(TestSoftwareInterrupt);
+#if GIC_RATE_LIMIT_ENABLE
+	TEST_RUN(TestStormLimiter);
+#endif
+	TEST_RUN(TestFiqCoexistence);
+	TEST_RUN(TestCpuInterfaceOnly);
+	return TEST_RESULT();
+}
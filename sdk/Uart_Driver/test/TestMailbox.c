@@ -0,0 +1,225 @@
+/*
+ * TestMailbox.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * Mailbox.c on the CPU and GIC models. both cores share the one sMailbox of this process, HostCpuSetCpuId
+ * selects the core the calls run as. the model has the CPU interface of CPU0 only, CPU0 keeps IRQ masked
+ * while code runs as CPU1 and the SGI is taken once it is back on CPU0.
+ */
+
+/**************Includes******************/
+#include <string.h>
+#include "TestCommon.h"
+#include "HostCpu.h"
+#include "GICHostModel.h"
+#include "GIC.h"
+#include "Mailbox.h"
+#include "xil_exception.h"
+#include "xil_mmu.h"
+
+/**************Preprocessor******************/
+#define TEST_CPU0 0U
+#define TEST_CPU1 1U
+#define TEST_RECEIVED_SIZE 64U
+#define TEST_LAPS 5U // times the ring indexes wrap in the SPSC test
+
+/**************Definitions******************/
+static GICInstanceType sGic;
+static RUINT32 sau4Received[TEST_RECEIVED_SIZE]; // u4Type of the messages the SGI handler took, in order
+static RUINT32 su4ReceivedCount;
+static RUINT32 su4HandlerCalls;
+
+static void testMessage(MailboxMessageType *pMessage, RUINT32 u4Sequence)
+{
+	RUINT32 u4Index;
+
+	pMessage->u4Type = u4Sequence;
+	for(u4Index = 0U; u4Index < MAILBOX_MESSAGE_WORDS; u4Index++)
+	{
+		pMessage->au4Data[u4Index] = (u4Sequence << 8) | u4Index;
+	}
+}
+
+static RUINT32 testCheckMessage(const MailboxMessageType *pMessage, RUINT32 u4Sequence)
+{
+	MailboxMessageType Expected;
+
+	testMessage(&Expected, u4Sequence);
+	return (memcmp(pMessage, &Expected, sizeof(Expected)) == 0) ? 1U : 0U;
+}
+
+/*receiver side of CPU0 : takes every message one SGI covers*/
+static void testMailboxHandler(void *pArgument)
+{
+	MailboxMessageType Message;
+
+	(void)pArgument;
+	su4HandlerCalls++;
+	while(MailboxReceive(&Message) == MAILBOX_SUCCESS)
+	{
+		if(su4ReceivedCount < TEST_RECEIVED_SIZE)
+		{
+			sau4Received[su4ReceivedCount++] = Message.u4Type;
+		}
+	}
+}
+
+static void testSetUp(void)
+{
+	HostCpuReset();
+	GICHostModelReset();
+	memset(sau4Received, 0, sizeof(sau4Received));
+	su4ReceivedCount = 0U;
+	su4HandlerCalls = 0U;
+	TEST_ASSERT(InitializeGIC(&sGic) == GIC_SUCCESS);
+	StartGIC();
+	Xil_ExceptionDisable();
+	TEST_ASSERT(MailboxInitialize(1U) == MAILBOX_SUCCESS);
+}
+
+/*CPU1 waits for the magic CPU0 writes, CPU0 resetting the channels drops queued messages*/
+static void TestHandshake(void)
+{
+	MailboxMessageType Message;
+
+	// first test of the program : nothing has initialized the mailbox yet
+	HostCpuReset();
+	HostCpuSetCpuId(TEST_CPU1);
+	TEST_ASSERT(MailboxGetCpuId() == TEST_CPU1);
+	TEST_ASSERT(MailboxInitialize(0U) == MAILBOX_FAILURE);
+	TEST_ASSERT(HostCpuGetTlbAttributes() == NORM_NONCACHE); // mapped before the magic is read
+
+	HostCpuSetCpuId(TEST_CPU0);
+	testSetUp();
+	TEST_ASSERT(HostCpuGetTlbAttributes() == NORM_NONCACHE);
+	HostCpuSetCpuId(TEST_CPU1);
+	TEST_ASSERT(MailboxInitialize(0U) == MAILBOX_SUCCESS);
+
+	testMessage(&Message, 1U);
+	TEST_ASSERT(MailboxSend(TEST_CPU0, &Message) == MAILBOX_SUCCESS);
+	HostCpuSetCpuId(TEST_CPU0);
+	TEST_ASSERT(MailboxInitialize(1U) == MAILBOX_SUCCESS);
+	TEST_ASSERT(MailboxReceive(&Message) == MAILBOX_EMPTY);
+	HostCpuSetCpuId(TEST_CPU1);
+	TEST_ASSERT(MailboxInitialize(0U) == MAILBOX_SUCCESS); // magic kept by the reset
+	HostCpuSetCpuId(TEST_CPU0);
+}
+
+/*CPU0 to CPU1 ring : FIFO order across several wraps of the slot index, full at MAILBOX_SLOT_COUNT*/
+static void TestSpscWrapAndFull(void)
+{
+	MailboxMessageType Message;
+	GICHostModelStatsType Stats;
+	RUINT32 u4Sent = 0U;
+	RUINT32 u4Taken = 0U;
+	RUINT32 u4Lap;
+	RUINT32 u4Index;
+
+	testSetUp();
+
+	TEST_ASSERT(MailboxSend(TEST_CPU0, &Message) == MAILBOX_FAILURE); // to itself
+	TEST_ASSERT(MailboxSend(MAILBOX_NUMBER_OF_CPUS, &Message) == MAILBOX_FAILURE);
+	TEST_ASSERT(MailboxSend(TEST_CPU1, NULL) == MAILBOX_FAILURE);
+	TEST_ASSERT(MailboxReceive(NULL) == MAILBOX_FAILURE);
+
+	for(u4Lap = 0U; u4Lap < TEST_LAPS; u4Lap++)
+	{
+		// sender fills the ring, receiver takes a different number each lap so head and tail wrap at every offset
+		HostCpuSetCpuId(TEST_CPU0);
+		while(u4Sent - u4Taken < MAILBOX_SLOT_COUNT)
+		{
+			testMessage(&Message, u4Sent);
+			TEST_ASSERT(MailboxSend(TEST_CPU1, &Message) == MAILBOX_SUCCESS);
+			u4Sent++;
+		}
+		testMessage(&Message, u4Sent);
+		TEST_ASSERT(MailboxSend(TEST_CPU1, &Message) == MAILBOX_FULL);
+
+		HostCpuSetCpuId(TEST_CPU1);
+		for(u4Index = 0U; u4Index < (3U + (u4Lap * 5U)) % MAILBOX_SLOT_COUNT + 1U; u4Index++)
+		{
+			TEST_ASSERT(MailboxReceive(&Message) == MAILBOX_SUCCESS);
+			TEST_ASSERT(testCheckMessage(&Message, u4Taken) == 1U);
+			u4Taken++;
+		}
+	}
+
+	// drain : the rest in order, then empty. nothing crossed to CPU0's ring
+	while(u4Taken < u4Sent)
+	{
+		TEST_ASSERT(MailboxReceive(&Message) == MAILBOX_SUCCESS);
+		TEST_ASSERT(testCheckMessage(&Message, u4Taken) == 1U);
+		u4Taken++;
+	}
+	TEST_ASSERT(MailboxReceive(&Message) == MAILBOX_EMPTY);
+	TEST_ASSERT(u4Sent > (TEST_LAPS * MAILBOX_SLOT_COUNT) / 2U);
+	HostCpuSetCpuId(TEST_CPU0);
+	TEST_ASSERT(MailboxReceive(&Message) == MAILBOX_EMPTY);
+
+	// SGIs went to CPU1 only, the CPU0 interface saw none of them
+	GICHostModelGetStats(&Stats);
+	TEST_ASSERT(Stats.u4SgiCount == 0U);
+	TEST_ASSERT(GICHostModelIsPending(MAILBOX_SGI_ID) == 0U);
+}
+
+/*CPU1 to CPU0 through SGI 0 : messages sent while CPU0 has IRQ masked are all taken by one handler call*/
+static void TestSgiSignal(void)
+{
+	MailboxMessageType Message;
+	GICHostModelStatsType Stats;
+	RUINT32 u4Index;
+
+	testSetUp();
+	TEST_ASSERT(GICConnectInterruptHandler(&sGic, MAILBOX_SGI_ID, testMailboxHandler, NULL) == GIC_SUCCESS);
+	TEST_ASSERT(GICEnableInterruptID(MAILBOX_SGI_ID) == GIC_SUCCESS);
+
+	HostCpuSetCpuId(TEST_CPU1);
+	TEST_ASSERT(MailboxInitialize(0U) == MAILBOX_SUCCESS);
+	for(u4Index = 0U; u4Index < 3U; u4Index++)
+	{
+		testMessage(&Message, u4Index);
+		TEST_ASSERT(MailboxSend(TEST_CPU0, &Message) == MAILBOX_SUCCESS);
+	}
+	GICHostModelGetStats(&Stats);
+	TEST_ASSERT(Stats.u4SgiCount == 3U);
+	TEST_ASSERT(GICHostModelIsPending(MAILBOX_SGI_ID) == 1U);
+	TEST_ASSERT(su4HandlerCalls == 0U);
+
+	HostCpuSetCpuId(TEST_CPU0);
+	Xil_ExceptionEnable();
+	TEST_ASSERT(HostCpuGetIrqCount() == 1U);
+	TEST_ASSERT(su4HandlerCalls == 1U);
+	TEST_ASSERT(su4ReceivedCount == 3U);
+	TEST_ASSERT(sau4Received[0] == 0U);
+	TEST_ASSERT(sau4Received[2] == 2U);
+	TEST_ASSERT(GICHostModelIsPending(MAILBOX_SGI_ID) == 0U);
+	TEST_ASSERT(GICHostModelIsActive(MAILBOX_SGI_ID) == 0U);
+
+	// one more message is one more SGI and handler call
+	Xil_ExceptionDisable();
+	HostCpuSetCpuId(TEST_CPU1);
+	testMessage(&Message, 3U);
+	TEST_ASSERT(MailboxSend(TEST_CPU0, &Message) == MAILBOX_SUCCESS);
+	HostCpuSetCpuId(TEST_CPU0);
+	Xil_ExceptionEnable();
+	TEST_ASSERT(su4HandlerCalls == 2U);
+	TEST_ASSERT(su4ReceivedCount == 4U);
+	TEST_ASSERT(sau4Received[3] == 3U);
+	GICHostModelGetStats(&Stats);
+	TEST_ASSERT(Stats.u4EoiCount == 2U);
+	TEST_ASSERT(Stats.u4EoiErrorCount == 0U);
+	Xil_ExceptionDisable();
+}
+
+int main(void)
+{
+	TEST_RUN(TestHandshake);
+	TEST_RUN(TestSpscWrapAndFull);
+	TEST_RUN(TestSgiSignal);
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,369 @@
+/*
+ * TestUart.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * Uart.c against the uart controller model, interrupts delivered through GIC.c and the GIC model :
+ * bring up, TX ring drained by the TX empty interrupt at line rate, zero copy TX, receive
+ * interrupts with trigger level / timeout / deferred callback, RX ring overflow and error counters.
+ */
+
+/**************Includes******************/
+#include <string.h>
+#include "TestCommon.h"
+#include "HostCpu.h"
+#include "GICHostModel.h"
+#include "UartHostModel.h"
+#include "GIC.h"
+#include "Uart.h"
+#include "xil_exception.h"
+
+/**************Preprocessor******************/
+#define TEST_UART_DEVICE 1U
+#define TEST_UART_ID UART_MODEL_UART1_ID
+#define TEST_TX_SIZE 3000U // about three rings worth, ring wraps and producer waits for room
+#define TEST_TX_CHUNK 100U
+#define TEST_RX_OVERFLOW_SIZE (UART_RX_RING_SIZE + 76U)
+#define TEST_MAIN_LOOP_CYCLES 2000U // work done by the main loop between two driver calls
+#define TEST_TX_IDLE_TAKEN (UART_TX_FIFO_DEPTH + 1U) // idle transmitter takes a fifo depth plus the shift register at once
+#define TEST_TRIAL_MESSAGE "bugra.erbas" // sent by polling during bring up, terminating 0 included
+
+/**************Definitions******************/
+static GICInstanceType sGic;
+static uartCfgType sUartCfg;
+static RUINT8 sau1TxData[TEST_TX_SIZE];
+static RUINT8 sau1RxData[TEST_RX_OVERFLOW_SIZE];
+static RUINT32 su4CallbackCount;
+static RUINT32 su4CallbackCpsr;
+
+static void testRxCallback(void *pArgument)
+{
+	(void)pArgument;
+	su4CallbackCount++;
+	su4CallbackCpsr = HostCpuGetCpsr();
+}
+
+/*fresh CPU, GIC and uart, uart 1 at u4BaudRate routed to the driver's interrupt handler*/
+static void testSetUp(RUINT32 u4BaudRate, RUINT8 u1RxTimeout)
+{
+	const uint8_t *pu1Wire;
+	RUINT32 u4WireCount;
+
+	HostCpuReset();
+	GICHostModelReset();
+	UartHostModelReset();
+	su4CallbackCount = 0U;
+
+	TEST_ASSERT(InitializeGIC(&sGic) == GIC_SUCCESS);
+	TEST_ASSERT(GICConnectInterruptHandler(&sGic, TEST_UART_ID, (void *)xUartPsInterruptHandler, &sUartCfg) == GIC_SUCCESS);
+	TEST_ASSERT(GICEnableInterruptID(TEST_UART_ID) == GIC_SUCCESS);
+	StartGIC();
+
+	memset(&sUartCfg, 0, sizeof(sUartCfg));
+	sUartCfg.DeviceNum = UART_INSTANCE_DEVICE_1;
+	sUartCfg.BaudRate = (uartBaudRateType)u4BaudRate;
+	sUartCfg.Parity = UART_PARITY_NONE;
+	sUartCfg.u1RxTimeout = u1RxTimeout;
+	sUartCfg.FlowControl = UART_FLOW_CONTROL_NONE;
+	TEST_ASSERT(InitializeUart(&sUartCfg) == XST_SUCCESS);
+
+	// polling send of the trial message, wait until it left the shift register
+	while(UartHostModelTxBusy(TEST_UART_DEVICE) != 0U)
+	{
+		UartHostModelAdvance(TEST_MAIN_LOOP_CYCLES);
+	}
+	u4WireCount = UartHostModelGetWire(TEST_UART_DEVICE, &pu1Wire);
+	TEST_ASSERT(u4WireCount == sizeof(TEST_TRIAL_MESSAGE));
+	TEST_ASSERT(memcmp(pu1Wire, TEST_TRIAL_MESSAGE, sizeof(TEST_TRIAL_MESSAGE)) == 0);
+	TEST_ASSERT(UartResetStats(&sUartCfg) == XST_SUCCESS);
+}
+
+/*main loop of a producer : queues as much as the ring takes, does other work, repeats until everything is queued*/
+static uint64_t testSendAll(const RUINT8 *pu1Data, RUINT32 u4Size)
+{
+	uint64_t u8Start = HostCpuGetCycles();
+	RUINT32 u4Queued = 0U;
+	RUINT32 u4Chunk;
+
+	while(u4Queued < u4Size)
+	{
+		u4Chunk = u4Size - u4Queued;
+		if(u4Chunk > TEST_TX_CHUNK)
+		{
+			u4Chunk = TEST_TX_CHUNK;
+		}
+		u4Queued += UartSendDataNonBlocking((RUINT8 *)&pu1Data[u4Queued], &sUartCfg, u4Chunk);
+		UartHostModelAdvance(TEST_MAIN_LOOP_CYCLES);
+	}
+	while((UartTxPending(&sUartCfg) != 0U) || (UartHostModelTxBusy(TEST_UART_DEVICE) != 0U))
+	{
+		UartHostModelAdvance(TEST_MAIN_LOOP_CYCLES);
+	}
+
+	return HostCpuGetCycles() - u8Start;
+}
+
+static void testFillPattern(RUINT8 *pu1Data, RUINT32 u4Size, RUINT32 u4Seed)
+{
+	RUINT32 u4Index;
+
+	for(u4Index = 0U; u4Index < u4Size; u4Index++)
+	{
+		pu1Data[u4Index] = (RUINT8)((u4Index * 7U) + u4Seed);
+	}
+}
+
+static void TestBringUp(void)
+{
+	uartBaudDivisorType Divisor;
+
+	testSetUp(UART_BAUDRATE_115200, UART_DEFAULT_RX_TIMEOUT);
+
+	TEST_ASSERT(UartGetBaudRateInfo(&sUartCfg, &Divisor) == XST_SUCCESS);
+	TEST_ASSERT(Divisor.u4ErrorPpm <= UART_BAUD_MAX_ERROR_PPM);
+	// receive interrupts and errors enabled, TX empty only while there is something to send
+	TEST_ASSERT((UartHostModelGetImr(TEST_UART_DEVICE) & 0x1E1U) == 0x1E1U);
+	TEST_ASSERT((UartHostModelGetImr(TEST_UART_DEVICE) & 0x08U) == 0U);
+	TEST_ASSERT(UartTxPending(&sUartCfg) == 0U);
+	TEST_ASSERT(UartTxFree(&sUartCfg) == UART_TX_RING_SIZE);
+}
+
+static void TestTxRing(void)
+{
+	UartHostModelStatsType ModelStats;
+	uartStatsType Stats;
+	const uint8_t *pu1Wire;
+	RUINT32 u4WireStart;
+	RUINT32 u4WireCount;
+	uint64_t u8Elapsed;
+	uint64_t u8LineTime;
+
+	testSetUp(UART_BAUDRATE_115200, UART_DEFAULT_RX_TIMEOUT);
+	testFillPattern(sau1TxData, TEST_TX_SIZE, 3U);
+	u4WireStart = UartHostModelGetWire(TEST_UART_DEVICE, &pu1Wire);
+
+	u8Elapsed = testSendAll(sau1TxData, TEST_TX_SIZE);
+
+	// every byte on the wire once and in order, nothing written into a full fifo
+	u4WireCount = UartHostModelGetWire(TEST_UART_DEVICE, &pu1Wire);
+	TEST_ASSERT(u4WireCount == (u4WireStart + TEST_TX_SIZE));
+	TEST_ASSERT(memcmp(&pu1Wire[u4WireStart], sau1TxData, TEST_TX_SIZE) == 0);
+	UartHostModelGetStats(TEST_UART_DEVICE, &ModelStats);
+	TEST_ASSERT(ModelStats.u4TxOverflowCount == 0U);
+
+	// TX empty interrupt is off once the ring is drained
+	TEST_ASSERT((UartHostModelGetImr(TEST_UART_DEVICE) & 0x08U) == 0U);
+	TEST_ASSERT(UartTxFree(&sUartCfg) == UART_TX_RING_SIZE);
+
+	// refill keeps the line busy : within 1% of the time the bytes take at line rate
+	u8LineTime = (uint64_t)UartHostModelCharCycles(TEST_UART_DEVICE) * TEST_TX_SIZE;
+	TEST_ASSERT(u8Elapsed >= u8LineTime);
+	TEST_ASSERT(u8Elapsed <= (u8LineTime + (u8LineTime / 100U)));
+
+	TEST_ASSERT(UartGetStats(&sUartCfg, &Stats) == XST_SUCCESS);
+#if UART_STATS_ENABLE
+	// one interrupt per fifo depth, a refill never writes more than the fifo holds
+	TEST_ASSERT(Stats.u4TxByteCount == TEST_TX_SIZE);
+	TEST_ASSERT(Stats.u4TxInterruptCount >= ((TEST_TX_SIZE + UART_TX_FIFO_DEPTH - 1U) / UART_TX_FIFO_DEPTH));
+	TEST_ASSERT(Stats.u4TxInterruptCount <= (((TEST_TX_SIZE + UART_TX_FIFO_DEPTH - 1U) / UART_TX_FIFO_DEPTH) + 2U));
+	TEST_ASSERT(Stats.u4IsrCycleMax != 0U);
+#endif
+	TEST_ASSERT(HostCpuGetExceptionDepth() == 0U);
+}
+
+/*ring full : UartSendDataNonBlocking takes what fits and the rest is queued after the interrupt made room*/
+static void TestTxRingFull(void)
+{
+	const uint8_t *pu1Wire;
+	RUINT32 u4WireStart;
+	RUINT32 u4Queued;
+
+	testSetUp(UART_BAUDRATE_921600, UART_DEFAULT_RX_TIMEOUT);
+	testFillPattern(sau1TxData, TEST_TX_SIZE, 11U);
+	u4WireStart = UartHostModelGetWire(TEST_UART_DEVICE, &pu1Wire);
+
+	// fifo and shift register are loaded at once, rest of the ring fills up
+	u4Queued = UartSendDataNonBlocking(sau1TxData, &sUartCfg, TEST_TX_SIZE);
+	TEST_ASSERT(u4Queued == UART_TX_RING_SIZE);
+	TEST_ASSERT(UartTxPending(&sUartCfg) == (UART_TX_RING_SIZE - TEST_TX_IDLE_TAKEN));
+	TEST_ASSERT(UartHostModelTxLevel(TEST_UART_DEVICE) == UART_TX_FIFO_DEPTH);
+	TEST_ASSERT(UartSendDataNonBlocking(&sau1TxData[u4Queued], &sUartCfg, TEST_TX_SIZE - u4Queued) == TEST_TX_IDLE_TAKEN);
+	u4Queued += TEST_TX_IDLE_TAKEN;
+
+	testSendAll(&sau1TxData[u4Queued], TEST_TX_SIZE - u4Queued);
+	TEST_ASSERT(UartHostModelGetWire(TEST_UART_DEVICE, &pu1Wire) == (u4WireStart + TEST_TX_SIZE));
+	TEST_ASSERT(memcmp(&pu1Wire[u4WireStart], sau1TxData, TEST_TX_SIZE) == 0);
+}
+
+/*zero copy producer : reserve / commit across the end of ring storage*/
+static void TestTxReserveCommit(void)
+{
+	const uint8_t *pu1Wire;
+	RUINT8 *pu1Slot;
+	RUINT32 u4WireStart;
+	RUINT32 u4Contiguous;
+	RUINT32 u4Offset = 0U;
+	RUINT32 u4Size = 200U;
+
+	testSetUp(UART_BAUDRATE_921600, UART_DEFAULT_RX_TIMEOUT);
+	testFillPattern(sau1TxData, TEST_TX_SIZE, 5U);
+
+	// move ring head close to the end of storage
+	testSendAll(sau1TxData, UART_TX_RING_SIZE - 50U);
+	u4WireStart = UartHostModelGetWire(TEST_UART_DEVICE, &pu1Wire);
+
+	u4Contiguous = UartTxReserve(&sUartCfg, 0U, &pu1Slot);
+	TEST_ASSERT(u4Contiguous == 50U);
+	while(u4Offset < u4Size)
+	{
+		u4Contiguous = UartTxReserve(&sUartCfg, u4Offset, &pu1Slot);
+		TEST_ASSERT(u4Contiguous != 0U);
+		if(u4Contiguous > (u4Size - u4Offset))
+		{
+			u4Contiguous = u4Size - u4Offset;
+		}
+		memcpy(pu1Slot, &sau1TxData[UART_TX_RING_SIZE + u4Offset], u4Contiguous);
+		u4Offset += u4Contiguous;
+	}
+	// nothing leaves before commit
+	UartHostModelAdvance(UartHostModelCharCycles(TEST_UART_DEVICE) * 4U);
+	TEST_ASSERT(UartHostModelGetWire(TEST_UART_DEVICE, &pu1Wire) == u4WireStart);
+	TEST_ASSERT(UartTxCommit(&sUartCfg, UART_TX_RING_SIZE + 1U) == XST_FAILURE);
+	TEST_ASSERT(UartTxCommit(&sUartCfg, u4Size) == XST_SUCCESS);
+
+	testSendAll(sau1TxData, 0U);
+	TEST_ASSERT(UartHostModelGetWire(TEST_UART_DEVICE, &pu1Wire) == (u4WireStart + u4Size));
+	TEST_ASSERT(memcmp(&pu1Wire[u4WireStart], &sau1TxData[UART_TX_RING_SIZE], u4Size) == 0);
+}
+
+/*trigger level interrupts take full batches, receiver timeout delivers the tail, callback runs once per batch*/
+static void TestRxTriggerAndTimeout(void)
+{
+	uartStatsType Stats;
+	RUINT8 au1Read[200];
+	RUINT32 u4Size = 100U;
+	RUINT32 u4Read;
+
+	testSetUp(UART_BAUDRATE_115200, UART_DEFAULT_RX_TIMEOUT);
+	TEST_ASSERT(UartSetRxCallback(&sUartCfg, testRxCallback, NULL) == XST_SUCCESS);
+	testFillPattern(sau1RxData, u4Size, 9U);
+
+	UartHostModelReceive(TEST_UART_DEVICE, sau1RxData, u4Size);
+	// 3 trigger level batches of 32, 4 bytes wait for the timeout
+	TEST_ASSERT(UartRead(&sUartCfg, au1Read, sizeof(au1Read)) == ((u4Size / UART_DEFAULT_RX_TRIGGER_LEVEL) * UART_DEFAULT_RX_TRIGGER_LEVEL));
+	TEST_ASSERT(su4CallbackCount == (u4Size / UART_DEFAULT_RX_TRIGGER_LEVEL));
+	TEST_ASSERT((su4CallbackCpsr & XIL_EXCEPTION_IRQ) == 0U);
+
+	// timeout : 4 * RXTOUT bit times of idle line
+	UartHostModelAdvance(UartHostModelCharCycles(TEST_UART_DEVICE) * UART_DEFAULT_RX_TIMEOUT);
+	u4Read = UartRead(&sUartCfg, au1Read, sizeof(au1Read));
+	TEST_ASSERT(u4Read == (u4Size % UART_DEFAULT_RX_TRIGGER_LEVEL));
+	TEST_ASSERT(memcmp(au1Read, &sau1RxData[u4Size - u4Read], u4Read) == 0);
+	TEST_ASSERT(su4CallbackCount == ((u4Size / UART_DEFAULT_RX_TRIGGER_LEVEL) + 1U));
+
+	TEST_ASSERT(UartGetStats(&sUartCfg, &Stats) == XST_SUCCESS);
+	TEST_ASSERT(Stats.u4RxDroppedCount == 0U);
+	TEST_ASSERT(Stats.u4RxOverrunCount == 0U);
+#if UART_STATS_ENABLE
+	TEST_ASSERT(Stats.u4RxByteCount == u4Size);
+	TEST_ASSERT(Stats.u4RxTimeoutCount == 1U);
+	TEST_ASSERT(Stats.u4RxInterruptCount == ((u4Size / UART_DEFAULT_RX_TRIGGER_LEVEL) + 1U));
+#endif
+}
+
+/*consumer does not read : ring takes UART_RX_RING_SIZE bytes, the rest is drained from the fifo and counted*/
+/*
+ * zeroed config selects the default timeout like it does the default trigger level : a burst shorter than
+ * the trigger level is delivered once the line is idle. with the timeout disabled it stays in the fifo.
+ */
+static void TestRxDefaultTimeout(void)
+{
+	RUINT8 au1Read[8];
+	RUINT32 u4Size = 5U;
+
+	testSetUp(UART_BAUDRATE_115200, 0U);
+	TEST_ASSERT((UartHostModelGetImr(TEST_UART_DEVICE) & 0x100U) == 0x100U);
+	testFillPattern(sau1RxData, u4Size, 3U);
+
+	UartHostModelReceive(TEST_UART_DEVICE, sau1RxData, u4Size);
+	TEST_ASSERT(UartRead(&sUartCfg, au1Read, sizeof(au1Read)) == 0U);
+	UartHostModelAdvance(UartHostModelCharCycles(TEST_UART_DEVICE) * UART_DEFAULT_RX_TIMEOUT);
+	TEST_ASSERT(UartRead(&sUartCfg, au1Read, sizeof(au1Read)) == u4Size);
+	TEST_ASSERT(memcmp(au1Read, sau1RxData, u4Size) == 0);
+
+	testSetUp(UART_BAUDRATE_115200, UART_RX_TIMEOUT_DISABLED);
+	TEST_ASSERT((UartHostModelGetImr(TEST_UART_DEVICE) & 0x100U) == 0U);
+	UartHostModelReceive(TEST_UART_DEVICE, sau1RxData, u4Size);
+	UartHostModelAdvance(UartHostModelCharCycles(TEST_UART_DEVICE) * UART_DEFAULT_RX_TIMEOUT * 4U);
+	TEST_ASSERT(UartRead(&sUartCfg, au1Read, sizeof(au1Read)) == 0U);
+	TEST_ASSERT(UartHostModelRead(0xE0001000U + 0x1CU) == 0U); // RXTOUT
+}
+
+static void TestRxRingOverflow(void)
+{
+	uartStatsType Stats;
+	RUINT8 *pu1Data;
+	RUINT32 u4Count = 0U;
+	RUINT32 u4Chunk;
+
+	testSetUp(UART_BAUDRATE_115200, UART_DEFAULT_RX_TIMEOUT);
+	testFillPattern(sau1RxData, TEST_RX_OVERFLOW_SIZE, 1U);
+
+	UartHostModelReceive(TEST_UART_DEVICE, sau1RxData, TEST_RX_OVERFLOW_SIZE);
+	UartHostModelAdvance(UartHostModelCharCycles(TEST_UART_DEVICE) * UART_DEFAULT_RX_TIMEOUT);
+
+	TEST_ASSERT(UartGetStats(&sUartCfg, &Stats) == XST_SUCCESS);
+	TEST_ASSERT(Stats.u4RxDroppedCount == (TEST_RX_OVERFLOW_SIZE - UART_RX_RING_SIZE));
+	TEST_ASSERT(Stats.u4RxOverrunCount == 0U);
+
+	// oldest bytes are kept, peek returns them in at most two chunks
+	while((u4Chunk = UartRxPeek(&sUartCfg, &pu1Data)) != 0U)
+	{
+		TEST_ASSERT(memcmp(pu1Data, &sau1RxData[u4Count], u4Chunk) == 0);
+		UartRxConsume(&sUartCfg, u4Chunk);
+		u4Count += u4Chunk;
+	}
+	TEST_ASSERT(u4Count == UART_RX_RING_SIZE);
+}
+
+/*framing, parity and fifo overrun events are counted, overrun also drains the fifo*/
+static void TestRxErrors(void)
+{
+	uartStatsType Stats;
+	RUINT8 au1Read[8];
+
+	testSetUp(UART_BAUDRATE_115200, UART_RX_TIMEOUT_DISABLED);
+	TEST_ASSERT((UartHostModelGetImr(TEST_UART_DEVICE) & 0x100U) == 0U); // timeout disabled : not enabled
+
+	UartHostModelRaiseError(TEST_UART_DEVICE, 0x40U); // framing
+	UartHostModelRaiseError(TEST_UART_DEVICE, 0x80U); // parity
+	UartHostModelRaiseError(TEST_UART_DEVICE, 0x40U | 0x80U);
+	UartHostModelReceive(TEST_UART_DEVICE, sau1RxData, 3U);
+	UartHostModelRaiseError(TEST_UART_DEVICE, 0x20U); // overrun
+
+	TEST_ASSERT(UartGetStats(&sUartCfg, &Stats) == XST_SUCCESS);
+	TEST_ASSERT(Stats.u4RxFramingErrorCount == 2U);
+	TEST_ASSERT(Stats.u4RxParityErrorCount == 2U);
+	TEST_ASSERT(Stats.u4RxOverrunCount == 1U);
+	TEST_ASSERT(UartRead(&sUartCfg, au1Read, sizeof(au1Read)) == 3U);
+
+	TEST_ASSERT(UartResetStats(&sUartCfg) == XST_SUCCESS);
+	TEST_ASSERT(UartGetStats(&sUartCfg, &Stats) == XST_SUCCESS);
+	TEST_ASSERT((Stats.u4RxFramingErrorCount == 0U) && (Stats.u4RxParityErrorCount == 0U) && (Stats.u4RxOverrunCount == 0U));
+}
+
+int main(void)
+{
+	TEST_RUN(TestBringUp);
+	TEST_RUN(TestTxRing);
+	TEST_RUN(TestTxRingFull);
+	TEST_RUN(TestTxReserveCommit);
+	TEST_RUN(TestRxTriggerAndTimeout);
+	TEST_RUN(TestRxDefaultTimeout);
+	TEST_RUN(TestRxRingOverflow);
+	TEST_RUN(TestRxErrors);
+	return TEST_RESULT();
+}
@@ -0,0 +1,213 @@
+/*
+ * TestUartBaud.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * UartSolveBaudRate against an exhaustive search of CD / BDIV / MR_CLKSEL, its limits, and
+ * InitializeUart programming the solution into the uart controller model.
+ */
+
+/**************Includes******************/
+#include <string.h>
+#include "TestCommon.h"
+#include "HostCpu.h"
+#include "GICHostModel.h"
+#include "UartHostModel.h"
+#include "GIC.h"
+#include "Uart.h"
+#include "xparameters.h"
+
+/**************Preprocessor******************/
+#define TEST_REF_CLK_HZ 50000000U // IO PLL 1 GHz / 20, what InitializeUart programs
+#define TEST_CD_MAX 65535U
+#define TEST_BDIV_MIN 4U
+#define TEST_BDIV_MAX 255U
+#define TEST_RATE_BDIV_MIN (TEST_REF_CLK_HZ / (TEST_BDIV_MIN + 1U)) // fastest rate : CD = 1, BDIV = 4
+#define TEST_RATE_NEEDS_CLKSEL 2U // sel_clk / 2 does not fit into CD * (BDIV + 1) without the / 8 prescaler
+#define TEST_RATE_TOO_COARSE 6000000U // 50 MHz / 8.33 : closest settings are 6.25 and 5.56 Mbaud, above 2.5%
+
+/**************Definitions******************/
+static const RUINT32 sau4Rates[] = {
+	110U, 300U, 9600U, 19200U, 38400U, 57600U,
+	UART_BAUDRATE_115200, 230400U, 460800U, UART_BAUDRATE_921600,
+	UART_BAUDRATE_1500000, UART_BAUDRATE_2000000, UART_BAUDRATE_3000000
+};
+
+/*smallest |actual - requested| any register setting gives, same integer arithmetic as the hardware*/
+static RUINT32 testBestDiff(RUINT32 u4RefClkHz, RUINT32 u4BaudRate)
+{
+	RUINT32 u4BestDiff = 0xFFFFFFFFU;
+	RUINT32 u4ClkSel;
+	RUINT32 u4SelClk;
+	RUINT32 u4Bdiv;
+	RUINT32 u4Cd;
+	RUINT32 u4Actual;
+	RUINT32 u4Diff;
+
+	for(u4ClkSel = 0U; u4ClkSel < 2U; u4ClkSel++)
+	{
+		u4SelClk = (u4ClkSel == 0U) ? u4RefClkHz : (u4RefClkHz / 8U);
+		for(u4Bdiv = TEST_BDIV_MIN; u4Bdiv <= TEST_BDIV_MAX; u4Bdiv++)
+		{
+			for(u4Cd = 1U; u4Cd <= TEST_CD_MAX; u4Cd++)
+			{
+				u4Actual = u4SelClk / (u4Cd * (u4Bdiv + 1U));
+				u4Diff = (u4Actual > u4BaudRate) ? (u4Actual - u4BaudRate) : (u4BaudRate - u4Actual);
+				if(u4Diff < u4BestDiff)
+				{
+					u4BestDiff = u4Diff;
+				}
+				if(u4Actual < u4BaudRate)
+				{
+					break; // larger CD only moves further away
+				}
+			}
+		}
+	}
+
+	return u4BestDiff;
+}
+
+/*solution is a valid register setting that gives the rate it reports*/
+static void testCheckDivisor(RUINT32 u4RefClkHz, RUINT32 u4BaudRate, const uartBaudDivisorType *pDivisor)
+{
+	RUINT32 u4SelClk = (pDivisor->u4ClkSelDiv8 != 0U) ? (u4RefClkHz / 8U) : u4RefClkHz;
+	RUINT32 u4Diff;
+
+	TEST_ASSERT((pDivisor->u4Bdiv >= TEST_BDIV_MIN) && (pDivisor->u4Bdiv <= TEST_BDIV_MAX));
+	TEST_ASSERT((pDivisor->u4Cd >= 1U) && (pDivisor->u4Cd <= TEST_CD_MAX));
+	TEST_ASSERT(pDivisor->u4ClkSelDiv8 <= 1U);
+	TEST_ASSERT(pDivisor->u4ActualBaudRate == (u4SelClk / (pDivisor->u4Cd * (pDivisor->u4Bdiv + 1U))));
+	u4Diff = (pDivisor->u4ActualBaudRate > u4BaudRate) ? (pDivisor->u4ActualBaudRate - u4BaudRate) : (u4BaudRate - pDivisor->u4ActualBaudRate);
+	TEST_ASSERT(pDivisor->u4ErrorPpm == (RUINT32)(((double)u4Diff * 1000000.0) / (double)u4BaudRate));
+}
+
+/*every listed rate : closest setting there is, within UART_BAUD_MAX_ERROR_PPM*/
+static void TestSolveRates(void)
+{
+	uartBaudDivisorType Divisor;
+	RUINT32 u4Index;
+	RUINT32 u4Diff;
+
+	for(u4Index = 0U; u4Index < (sizeof(sau4Rates) / sizeof(sau4Rates[0])); u4Index++)
+	{
+		memset(&Divisor, 0, sizeof(Divisor));
+		TEST_ASSERT(UartSolveBaudRate(TEST_REF_CLK_HZ, sau4Rates[u4Index], &Divisor) == XST_SUCCESS);
+		testCheckDivisor(TEST_REF_CLK_HZ, sau4Rates[u4Index], &Divisor);
+		TEST_ASSERT(Divisor.u4ErrorPpm <= UART_BAUD_MAX_ERROR_PPM);
+		u4Diff = (Divisor.u4ActualBaudRate > sau4Rates[u4Index]) ? (Divisor.u4ActualBaudRate - sau4Rates[u4Index]) :
+				(sau4Rates[u4Index] - Divisor.u4ActualBaudRate);
+		if(u4Diff != testBestDiff(TEST_REF_CLK_HZ, sau4Rates[u4Index]))
+		{
+			printf("  rate %u : solver off by %u, best %u\n", sau4Rates[u4Index], u4Diff, testBestDiff(TEST_REF_CLK_HZ, sau4Rates[u4Index]));
+			su4TestFailures++;
+		}
+	}
+
+	// 2 Mbaud divides 50 MHz exactly : CD 1, BDIV 24
+	TEST_ASSERT(UartSolveBaudRate(TEST_REF_CLK_HZ, UART_BAUDRATE_2000000, &Divisor) == XST_SUCCESS);
+	TEST_ASSERT(Divisor.u4ErrorPpm == 0U);
+	TEST_ASSERT(Divisor.u4ClkSelDiv8 == 0U);
+}
+
+/*BDIV 4 is the fastest setting, a rate that needs BDIV 3 gets BDIV 4 and its error*/
+static void TestSolveBdivLimits(void)
+{
+	uartBaudDivisorType Divisor;
+
+	TEST_ASSERT(UartSolveBaudRate(TEST_REF_CLK_HZ, TEST_RATE_BDIV_MIN, &Divisor) == XST_SUCCESS);
+	TEST_ASSERT((Divisor.u4Bdiv == TEST_BDIV_MIN) && (Divisor.u4Cd == 1U) && (Divisor.u4ClkSelDiv8 == 0U));
+	TEST_ASSERT(Divisor.u4ErrorPpm == 0U);
+
+	TEST_ASSERT(UartSolveBaudRate(TEST_REF_CLK_HZ, TEST_REF_CLK_HZ / TEST_BDIV_MIN, &Divisor) == XST_SUCCESS);
+	TEST_ASSERT((Divisor.u4Bdiv == TEST_BDIV_MIN) && (Divisor.u4Cd == 1U));
+	TEST_ASSERT(Divisor.u4ActualBaudRate == TEST_RATE_BDIV_MIN);
+	TEST_ASSERT(Divisor.u4ErrorPpm == 200000U); // 12.5 Mbaud requested, 10 Mbaud possible
+
+	// slowest rates use the largest dividers, BDIV never leaves 4..255
+	TEST_ASSERT(UartSolveBaudRate(TEST_REF_CLK_HZ, 110U, &Divisor) == XST_SUCCESS);
+	testCheckDivisor(TEST_REF_CLK_HZ, 110U, &Divisor);
+
+	// invalid input
+	TEST_ASSERT(UartSolveBaudRate(TEST_REF_CLK_HZ, 0U, &Divisor) == XST_FAILURE);
+	TEST_ASSERT(UartSolveBaudRate(0U, UART_BAUDRATE_115200, &Divisor) == XST_FAILURE);
+	TEST_ASSERT(UartSolveBaudRate(TEST_REF_CLK_HZ, UART_BAUDRATE_115200, NULL) == XST_FAILURE);
+}
+
+/*rates below sel_clk / (65535 * 256) are only reachable through MR_CLKSEL*/
+static void TestSolveClkSelDiv8(void)
+{
+	uartBaudDivisorType Divisor;
+
+	TEST_ASSERT(UartSolveBaudRate(TEST_REF_CLK_HZ, TEST_RATE_NEEDS_CLKSEL, &Divisor) == XST_SUCCESS);
+	TEST_ASSERT(Divisor.u4ClkSelDiv8 == 1U);
+	testCheckDivisor(TEST_REF_CLK_HZ, TEST_RATE_NEEDS_CLKSEL, &Divisor);
+	TEST_ASSERT(Divisor.u4ErrorPpm <= UART_BAUD_MAX_ERROR_PPM);
+
+	// undivided clock is preferred when it is as good
+	TEST_ASSERT(UartSolveBaudRate(TEST_REF_CLK_HZ, UART_BAUDRATE_115200, &Divisor) == XST_SUCCESS);
+	TEST_ASSERT(Divisor.u4ClkSelDiv8 == 0U);
+}
+
+/*closest setting more than UART_BAUD_MAX_ERROR_PPM away : solver reports it, InitializeUart refuses it*/
+static void TestRejectCoarseRate(void)
+{
+	uartBaudDivisorType Divisor;
+	uartCfgType UartCfg;
+
+	TEST_ASSERT(UartSolveBaudRate(TEST_REF_CLK_HZ, TEST_RATE_TOO_COARSE, &Divisor) == XST_SUCCESS);
+	TEST_ASSERT(Divisor.u4ErrorPpm > UART_BAUD_MAX_ERROR_PPM);
+	TEST_ASSERT(testBestDiff(TEST_REF_CLK_HZ, TEST_RATE_TOO_COARSE) > ((TEST_RATE_TOO_COARSE / 1000000U) * UART_BAUD_MAX_ERROR_PPM));
+
+	HostCpuReset();
+	GICHostModelReset();
+	UartHostModelReset();
+	memset(&UartCfg, 0, sizeof(UartCfg));
+	UartCfg.DeviceNum = UART_INSTANCE_DEVICE_0;
+	UartCfg.BaudRate = (uartBaudRateType)TEST_RATE_TOO_COARSE;
+	UartCfg.Parity = UART_PARITY_NONE;
+	TEST_ASSERT(InitializeUart(&UartCfg) == XST_FAILURE);
+}
+
+/*InitializeUart writes the solution : character time of the controller model matches the solved rate*/
+static void TestInitializeProgramsDivisor(void)
+{
+	static const RUINT32 au4Rates[] = { TEST_RATE_NEEDS_CLKSEL, UART_BAUDRATE_115200, UART_BAUDRATE_3000000 };
+	uartBaudDivisorType Divisor;
+	uartCfgType UartCfg;
+	RUINT32 u4Index;
+	uint64_t u8Divider;
+	uint64_t u8Expected;
+
+	for(u4Index = 0U; u4Index < (sizeof(au4Rates) / sizeof(au4Rates[0])); u4Index++)
+	{
+		HostCpuReset();
+		GICHostModelReset();
+		UartHostModelReset();
+		memset(&UartCfg, 0, sizeof(UartCfg));
+		UartCfg.DeviceNum = UART_INSTANCE_DEVICE_0;
+		UartCfg.BaudRate = (uartBaudRateType)au4Rates[u4Index];
+		UartCfg.Parity = UART_PARITY_NONE;
+		TEST_ASSERT(InitializeUart(&UartCfg) == XST_SUCCESS);
+		TEST_ASSERT(UartGetBaudRateInfo(&UartCfg, &Divisor) == XST_SUCCESS);
+		TEST_ASSERT(Divisor.u4ClkSelDiv8 == ((au4Rates[u4Index] == TEST_RATE_NEEDS_CLKSEL) ? 1U : 0U));
+
+		// BRGR, BRDR and MR_CLKSEL as the controller sees them : 10 bit times of the solved divider
+		u8Divider = (uint64_t)Divisor.u4Cd * (Divisor.u4Bdiv + 1U) * ((Divisor.u4ClkSelDiv8 != 0U) ? 8U : 1U);
+		u8Expected = (((uint64_t)XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ * u8Divider) / UartGetRefClockHz()) * 10U;
+		TEST_ASSERT(UartHostModelCharCycles(UART_INSTANCE_DEVICE_0) == u8Expected);
+	}
+}
+
+int main(void)
+{
+	TEST_RUN(TestSolveRates);
+	TEST_RUN(TestSolveBdivLimits);
+	TEST_RUN(TestSolveClkSelDiv8);
+	TEST_RUN(TestRejectCoarseRate);
+	TEST_RUN(TestInitializeProgramsDivisor);
+	return TEST_RESULT();
+}
@@ -0,0 +1,493 @@
+/*
+ * TestUartPacket.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * UartPacket.c on top of Uart.c and the uart model : frames sent on the TX line are fed back to the
+ * receiver of the same uart. round trip, SLIP escaping against a reference encoder, CRC reject,
+ * frames decoded in place in the RX ring and staged when they wrap, oversized frames on both paths
+ * and UartPacketSendV refusing a frame the TX ring cannot take.
+ * encode / decode throughput is timed with the host clock : the codec is plain C so the numbers
+ * compare codec changes on the build machine, they are not target figures.
+ */
+
+/**************Includes******************/
+#include <string.h>
+#include <time.h>
+#include "TestCommon.h"
+#include "HostCpu.h"
+#include "GICHostModel.h"
+#include "UartHostModel.h"
+#include "GIC.h"
+#include "Uart.h"
+#include "UartPacket.h"
+
+/**************Preprocessor******************/
+#define TEST_UART_DEVICE 1U
+#define TEST_UART_ID UART_MODEL_UART1_ID
+#define TEST_ENCODED_MAX (((UART_PACKET_MAX_FRAME_SIZE + UART_PACKET_CRC_SIZE) * 2U) + 2U)
+#define TEST_FILLER_PAYLOAD 496U // 500 bytes on the wire without special characters
+#define TEST_OVERSIZED_PAYLOAD (UART_PACKET_MAX_FRAME_SIZE + 88U)
+#define TEST_BENCH_PAYLOAD 256U
+#define TEST_BENCH_FRAMES 1024U
+#define TEST_NS_PER_SECOND 1000000000ULL
+
+/**************Definitions******************/
+static GICInstanceType sGic;
+static uartCfgType sUartCfg;
+static RUINT8 sau1Payload[TEST_ENCODED_MAX];
+static RUINT8 sau1Expected[TEST_ENCODED_MAX];
+static RUINT32 su4WireStart; // wire bytes already looped back
+static uartPacketStatsType sStatsStart; // packet layer state is static, counters are checked as deltas
+
+/*fresh CPU, GIC and uart, uart 1 at 921600 routed to the driver's interrupt handler*/
+static void testSetUp(void)
+{
+	const uint8_t *pu1Wire;
+	RUINT8 *pu1Frame;
+	RUINT32 u4Size;
+
+	// give back a frame the previous test left in place in the RX ring
+	while(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_SUCCESS)
+	{
+	}
+
+	HostCpuReset();
+	GICHostModelReset();
+	UartHostModelReset();
+
+	TEST_ASSERT(InitializeGIC(&sGic) == GIC_SUCCESS);
+	TEST_ASSERT(GICConnectInterruptHandler(&sGic, TEST_UART_ID, (void *)xUartPsInterruptHandler, &sUartCfg) == GIC_SUCCESS);
+	TEST_ASSERT(GICEnableInterruptID(TEST_UART_ID) == GIC_SUCCESS);
+	StartGIC();
+
+	memset(&sUartCfg, 0, sizeof(sUartCfg));
+	sUartCfg.DeviceNum = UART_INSTANCE_DEVICE_1;
+	sUartCfg.BaudRate = UART_BAUDRATE_921600;
+	sUartCfg.Parity = UART_PARITY_NONE;
+	sUartCfg.u1RxTimeout = UART_DEFAULT_RX_TIMEOUT;
+	sUartCfg.FlowControl = UART_FLOW_CONTROL_NONE;
+	TEST_ASSERT(InitializeUart(&sUartCfg) == XST_SUCCESS);
+
+	// trial message of the bring up is not looped back
+	while(UartHostModelTxBusy(TEST_UART_DEVICE) != 0U)
+	{
+		UartHostModelAdvance(UartHostModelCharCycles(TEST_UART_DEVICE));
+	}
+	su4WireStart = UartHostModelGetWire(TEST_UART_DEVICE, &pu1Wire);
+	TEST_ASSERT(UartPacketGetStats(&sUartCfg, &sStatsStart) == XST_SUCCESS);
+}
+
+/*packet counters since testSetUp*/
+static void testGetStats(uartPacketStatsType *pStats)
+{
+	TEST_ASSERT(UartPacketGetStats(&sUartCfg, pStats) == XST_SUCCESS);
+	pStats->u4TxFrameCount -= sStatsStart.u4TxFrameCount;
+	pStats->u4RxFrameCount -= sStatsStart.u4RxFrameCount;
+	pStats->u4RxCrcErrorCount -= sStatsStart.u4RxCrcErrorCount;
+	pStats->u4RxOverflowCount -= sStatsStart.u4RxOverflowCount;
+}
+
+/*lets the TX ring and the transmitter run empty*/
+static void testDrainTx(void)
+{
+	while((UartTxPending(&sUartCfg) != 0U) || (UartHostModelTxBusy(TEST_UART_DEVICE) != 0U))
+	{
+		UartHostModelAdvance(UartHostModelCharCycles(TEST_UART_DEVICE) * 16U);
+	}
+}
+
+/*bytes arrive on the RX line, receiver timeout passes so the tail below the trigger level reaches the RX ring too*/
+static void testReceive(const RUINT8 *pu1Data, RUINT32 u4Size)
+{
+	UartHostModelReceive(TEST_UART_DEVICE, pu1Data, u4Size);
+	UartHostModelAdvance(UartHostModelCharCycles(TEST_UART_DEVICE) * UART_DEFAULT_RX_TIMEOUT);
+}
+
+/*sends what is queued and receives it back on the same uart, returns the bytes sent since the last call*/
+static RUINT32 testLoopBack(const uint8_t **ppu1Sent)
+{
+	const uint8_t *pu1Wire;
+	RUINT32 u4WireSize;
+	RUINT32 u4Sent;
+
+	testDrainTx();
+	u4WireSize = UartHostModelGetWire(TEST_UART_DEVICE, &pu1Wire);
+	TEST_ASSERT(u4WireSize < UART_MODEL_WIRE_SIZE);
+	u4Sent = u4WireSize - su4WireStart;
+	*ppu1Sent = &pu1Wire[su4WireStart];
+	su4WireStart = u4WireSize;
+
+	testReceive(*ppu1Sent, u4Sent);
+	return u4Sent;
+}
+
+/*reference SLIP encoder of a whole frame, CRC appended*/
+static RUINT32 testEncode(const RUINT8 *pu1Payload, RUINT32 u4Size, RUINT8 *pu1Out)
+{
+	RUINT16 u2Crc = UartPacketCrc16(0xFFFFU, pu1Payload, u4Size);
+	RUINT8 au1Crc[UART_PACKET_CRC_SIZE];
+	RUINT32 u4Out = 0U;
+	RUINT32 u4Index;
+	RUINT8 u1Byte;
+
+	au1Crc[0] = (RUINT8)(u2Crc >> 8);
+	au1Crc[1] = (RUINT8)(u2Crc & 0xFFU);
+
+	pu1Out[u4Out++] = SLIP_END;
+	for(u4Index = 0U; u4Index < (u4Size + UART_PACKET_CRC_SIZE); u4Index++)
+	{
+		u1Byte = (u4Index < u4Size) ? pu1Payload[u4Index] : au1Crc[u4Index - u4Size];
+		if(u1Byte == SLIP_END)
+		{
+			pu1Out[u4Out++] = SLIP_ESC;
+			pu1Out[u4Out++] = SLIP_ESC_END;
+		}
+		else if(u1Byte == SLIP_ESC)
+		{
+			pu1Out[u4Out++] = SLIP_ESC;
+			pu1Out[u4Out++] = SLIP_ESC_ESC;
+		}
+		else
+		{
+			pu1Out[u4Out++] = u1Byte;
+		}
+	}
+	pu1Out[u4Out++] = SLIP_END;
+
+	return u4Out;
+}
+
+/*payload without special characters unless u4SpecialEvery != 0, then every u4SpecialEvery th byte is END or ESC*/
+static void testFillPayload(RUINT8 *pu1Data, RUINT32 u4Size, RUINT32 u4SpecialEvery)
+{
+	RUINT32 u4Index;
+
+	for(u4Index = 0U; u4Index < u4Size; u4Index++)
+	{
+		pu1Data[u4Index] = (RUINT8)(u4Index % 0xC0U);
+		if((u4SpecialEvery != 0U) && ((u4Index % u4SpecialEvery) == (u4SpecialEvery - 1U)))
+		{
+			pu1Data[u4Index] = ((u4Index / u4SpecialEvery) & 1U) ? SLIP_ESC : SLIP_END;
+		}
+	}
+}
+
+static RUINT32 testIsInPlace(const RUINT8 *pu1Frame)
+{
+	RUINT8 *pu1Ring;
+
+	// a frame returned in place stays in the RX ring until the next receive call
+	return ((UartRxPeek(&sUartCfg, &pu1Ring) != 0U) && (pu1Ring == pu1Frame)) ? 1U : 0U;
+}
+
+static uint64_t testNow(void)
+{
+	struct timespec Now;
+
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+	return ((uint64_t)Now.tv_sec * TEST_NS_PER_SECOND) + (uint64_t)Now.tv_nsec;
+}
+
+static void testPrintRate(const char *pcName, uint64_t u8Bytes, uint64_t u8Ns)
+{
+	uint64_t u8KBps = (u8Ns == 0U) ? 0U : ((u8Bytes * (TEST_NS_PER_SECOND / 1000U)) / u8Ns);
+
+	printf("%s : %u bytes in %u us, %u.%02u MB/s\n", pcName, (unsigned int)u8Bytes, (unsigned int)(u8Ns / 1000U),
+			(unsigned int)(u8KBps / 1000U), (unsigned int)((u8KBps % 1000U) / 10U));
+}
+
+static void TestRoundTrip(void)
+{
+	const uint8_t *pu1Sent;
+	uartPacketStatsType Stats;
+	uartPacketSegmentType aSegments[3];
+	RUINT8 *pu1Frame;
+	RUINT32 u4Size;
+	RUINT32 u4Index;
+
+	testSetUp();
+	testFillPayload(sau1Payload, 300U, 37U);
+
+	TEST_ASSERT(UartPacketSend(&sUartCfg, sau1Payload, 300U) == XST_SUCCESS);
+	(void)testLoopBack(&pu1Sent);
+	TEST_ASSERT(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_SUCCESS);
+	TEST_ASSERT(u4Size == 300U);
+	TEST_ASSERT(memcmp(pu1Frame, sau1Payload, 300U) == 0);
+	TEST_ASSERT(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_FAILURE);
+
+	// header, empty piece and payload in different buffers arrive as one frame
+	aSegments[0].pu1Data = &sau1Payload[0];
+	aSegments[0].u4Size = 10U;
+	aSegments[1].pu1Data = NULL;
+	aSegments[1].u4Size = 0U;
+	aSegments[2].pu1Data = &sau1Payload[10];
+	aSegments[2].u4Size = 90U;
+	TEST_ASSERT(UartPacketSendV(&sUartCfg, aSegments, 3U) == XST_SUCCESS);
+	(void)testLoopBack(&pu1Sent);
+	TEST_ASSERT(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_SUCCESS);
+	TEST_ASSERT(u4Size == 100U);
+	TEST_ASSERT(memcmp(pu1Frame, sau1Payload, 100U) == 0);
+
+	// empty payload is a frame of CRC only
+	TEST_ASSERT(UartPacketSend(&sUartCfg, NULL, 0U) == XST_SUCCESS);
+	(void)testLoopBack(&pu1Sent);
+	TEST_ASSERT(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_SUCCESS);
+	TEST_ASSERT(u4Size == 0U);
+
+	testGetStats(&Stats);
+	TEST_ASSERT(Stats.u4TxFrameCount == 3U);
+	TEST_ASSERT(Stats.u4RxFrameCount == 3U);
+	TEST_ASSERT(Stats.u4RxCrcErrorCount == 0U);
+	TEST_ASSERT(Stats.u4RxOverflowCount == 0U);
+
+	for(u4Index = 0U; u4Index < 3U; u4Index++)
+	{
+		TEST_ASSERT(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_FAILURE);
+	}
+}
+
+static void TestEscaping(void)
+{
+	static const RUINT8 au1Special[] = { SLIP_END, SLIP_ESC, SLIP_ESC_END, SLIP_ESC_ESC, SLIP_ESC, SLIP_END, 0x00U };
+	static const RUINT8 au1Head[] = { SLIP_END, SLIP_ESC, SLIP_ESC_END, SLIP_ESC, SLIP_ESC_ESC, SLIP_ESC_END,
+			SLIP_ESC_ESC, SLIP_ESC, SLIP_ESC_ESC, SLIP_ESC, SLIP_ESC_END, 0x00U };
+	const uint8_t *pu1Sent;
+	RUINT8 *pu1Frame;
+	RUINT32 u4Sent;
+	RUINT32 u4Expected;
+	RUINT32 u4Size;
+	RUINT32 u4Index;
+
+	testSetUp();
+
+	TEST_ASSERT(UartPacketSend(&sUartCfg, au1Special, sizeof(au1Special)) == XST_SUCCESS);
+	u4Sent = testLoopBack(&pu1Sent);
+	u4Expected = testEncode(au1Special, sizeof(au1Special), sau1Expected);
+	TEST_ASSERT(u4Sent == u4Expected);
+	TEST_ASSERT(memcmp(pu1Sent, sau1Expected, u4Expected) == 0);
+	// END and ESC only appear escaped, ESC_END / ESC_ESC alone are sent as they are
+	TEST_ASSERT(memcmp(pu1Sent, au1Head, sizeof(au1Head)) == 0);
+	for(u4Index = 1U; u4Index < (u4Sent - 1U); u4Index++)
+	{
+		TEST_ASSERT(pu1Sent[u4Index] != SLIP_END);
+	}
+
+	TEST_ASSERT(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_SUCCESS);
+	TEST_ASSERT(u4Size == sizeof(au1Special));
+	TEST_ASSERT(memcmp(pu1Frame, au1Special, sizeof(au1Special)) == 0);
+
+	// every byte special : worst case size on the wire
+	memset(sau1Payload, SLIP_END, 200U);
+	TEST_ASSERT(UartPacketSend(&sUartCfg, sau1Payload, 200U) == XST_SUCCESS);
+	u4Sent = testLoopBack(&pu1Sent);
+	u4Expected = testEncode(sau1Payload, 200U, sau1Expected);
+	TEST_ASSERT(u4Sent == u4Expected);
+	TEST_ASSERT(memcmp(pu1Sent, sau1Expected, u4Expected) == 0);
+	TEST_ASSERT(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_SUCCESS);
+	TEST_ASSERT(u4Size == 200U);
+	TEST_ASSERT(memcmp(pu1Frame, sau1Payload, 200U) == 0);
+}
+
+static void TestCrcReject(void)
+{
+	const uint8_t *pu1Sent;
+	uartPacketStatsType Stats;
+	RUINT8 *pu1Frame;
+	RUINT32 u4Encoded;
+	RUINT32 u4Size;
+
+	testSetUp();
+	testFillPayload(sau1Payload, 64U, 0U);
+
+	// payload byte flipped on the line
+	u4Encoded = testEncode(sau1Payload, 64U, sau1Expected);
+	sau1Expected[20] ^= 0x01U;
+	testReceive(sau1Expected, u4Encoded);
+	TEST_ASSERT(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_FAILURE);
+
+	// frame shorter than the CRC
+	sau1Expected[0] = SLIP_END;
+	sau1Expected[1] = 0x55U;
+	sau1Expected[2] = SLIP_END;
+	testReceive(sau1Expected, 3U);
+	TEST_ASSERT(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_FAILURE);
+
+	testGetStats(&Stats);
+	TEST_ASSERT(Stats.u4RxCrcErrorCount == 2U);
+	TEST_ASSERT(Stats.u4RxFrameCount == 0U);
+
+	// the next good frame gets through
+	TEST_ASSERT(UartPacketSend(&sUartCfg, sau1Payload, 64U) == XST_SUCCESS);
+	(void)testLoopBack(&pu1Sent);
+	TEST_ASSERT(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_SUCCESS);
+	TEST_ASSERT(u4Size == 64U);
+	TEST_ASSERT(memcmp(pu1Frame, sau1Payload, 64U) == 0);
+}
+
+/*
+ * two 500 byte frames fill the RX ring up to 1000, both are decoded in place. the third one wraps
+ * around the end of ring storage and is returned from the staging buffer.
+ */
+static void TestInPlaceAndWrapped(void)
+{
+	const uint8_t *pu1Sent;
+	uartPacketStatsType Stats;
+	RUINT8 *pu1Frame;
+	RUINT32 u4Size;
+	RUINT32 u4Frame;
+
+	testSetUp();
+
+	for(u4Frame = 0U; u4Frame < 2U; u4Frame++)
+	{
+		testFillPayload(sau1Payload, TEST_FILLER_PAYLOAD, 0U);
+		sau1Payload[0] = (RUINT8)u4Frame;
+		TEST_ASSERT(UartPacketSend(&sUartCfg, sau1Payload, TEST_FILLER_PAYLOAD) == XST_SUCCESS);
+		(void)testLoopBack(&pu1Sent);
+		TEST_ASSERT(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_SUCCESS);
+		TEST_ASSERT(u4Size == TEST_FILLER_PAYLOAD);
+		TEST_ASSERT(memcmp(pu1Frame, sau1Payload, TEST_FILLER_PAYLOAD) == 0);
+		TEST_ASSERT(testIsInPlace(pu1Frame) == 1U);
+	}
+
+	testFillPayload(sau1Payload, 100U, 9U);
+	TEST_ASSERT(UartPacketSend(&sUartCfg, sau1Payload, 100U) == XST_SUCCESS);
+	(void)testLoopBack(&pu1Sent);
+	TEST_ASSERT(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_SUCCESS);
+	TEST_ASSERT(u4Size == 100U);
+	TEST_ASSERT(memcmp(pu1Frame, sau1Payload, 100U) == 0);
+	TEST_ASSERT(testIsInPlace(pu1Frame) == 0U);
+
+	testGetStats(&Stats);
+	TEST_ASSERT(Stats.u4RxFrameCount == 3U);
+	TEST_ASSERT(Stats.u4RxCrcErrorCount == 0U);
+}
+
+/*frames longer than UART_PACKET_MAX_FRAME_SIZE are dropped whether they are contiguous in the ring or wrap*/
+static void TestOversizedFrame(void)
+{
+	uartPacketStatsType Stats;
+	RUINT8 *pu1Frame;
+	RUINT32 u4Encoded;
+	RUINT32 u4Size;
+	RUINT32 u4Case;
+
+	testSetUp();
+	testFillPayload(sau1Payload, TEST_OVERSIZED_PAYLOAD, 0U);
+	u4Encoded = testEncode(sau1Payload, TEST_OVERSIZED_PAYLOAD, sau1Expected);
+
+	// first one starts at the beginning of the ring, the second one at 600 and wraps
+	for(u4Case = 0U; u4Case < 2U; u4Case++)
+	{
+		testReceive(sau1Expected, u4Encoded);
+		TEST_ASSERT(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_FAILURE);
+		testGetStats(&Stats);
+		TEST_ASSERT(Stats.u4RxOverflowCount == (u4Case + 1U));
+		TEST_ASSERT(Stats.u4RxFrameCount == 0U);
+		TEST_ASSERT(Stats.u4RxCrcErrorCount == 0U);
+	}
+
+	// largest frame that fits, then the receiver is in sync again
+	testFillPayload(sau1Payload, UART_PACKET_MAX_FRAME_SIZE - UART_PACKET_CRC_SIZE, 0U);
+	u4Encoded = testEncode(sau1Payload, UART_PACKET_MAX_FRAME_SIZE - UART_PACKET_CRC_SIZE, sau1Expected);
+	testReceive(sau1Expected, u4Encoded);
+	TEST_ASSERT(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_SUCCESS);
+	TEST_ASSERT(u4Size == (UART_PACKET_MAX_FRAME_SIZE - UART_PACKET_CRC_SIZE));
+	TEST_ASSERT(memcmp(pu1Frame, sau1Payload, u4Size) == 0);
+}
+
+/*the frame is refused as a whole if its worst case encoding does not fit in UartTxFree*/
+static void TestSendRefusedOverTxFree(void)
+{
+	const uint8_t *pu1Sent;
+	uartPacketStatsType Stats;
+	uartPacketSegmentType aSegments[2];
+	RUINT32 u4Largest = (UART_TX_RING_SIZE - 2U) / 2U - UART_PACKET_CRC_SIZE; // 2 ENDs, every byte escaped
+
+	testSetUp();
+	testFillPayload(sau1Payload, u4Largest + 1U, 0U);
+	TEST_ASSERT(UartTxFree(&sUartCfg) == UART_TX_RING_SIZE);
+
+	aSegments[0].pu1Data = sau1Payload;
+	aSegments[0].u4Size = 1U;
+	aSegments[1].pu1Data = &sau1Payload[1];
+	aSegments[1].u4Size = u4Largest;
+	TEST_ASSERT(UartPacketSendV(&sUartCfg, aSegments, 2U) == XST_FAILURE);
+	TEST_ASSERT(UartTxPending(&sUartCfg) == 0U);
+	TEST_ASSERT(UartHostModelTxBusy(TEST_UART_DEVICE) == 0U);
+
+	// room for it once nothing is queued, not while a frame is still in the ring
+	TEST_ASSERT(UartPacketSend(&sUartCfg, sau1Payload, 200U) == XST_SUCCESS);
+	TEST_ASSERT(UartTxFree(&sUartCfg) < UART_TX_RING_SIZE);
+	TEST_ASSERT(UartPacketSend(&sUartCfg, sau1Payload, u4Largest) == XST_FAILURE);
+	(void)testLoopBack(&pu1Sent);
+	TEST_ASSERT(UartPacketSend(&sUartCfg, sau1Payload, u4Largest) == XST_SUCCESS);
+	(void)testLoopBack(&pu1Sent);
+
+	TEST_ASSERT(UartPacketSendV(NULL, aSegments, 2U) == XST_FAILURE);
+	TEST_ASSERT(UartPacketSendV(&sUartCfg, NULL, 1U) == XST_FAILURE);
+	aSegments[1].pu1Data = NULL;
+	TEST_ASSERT(UartPacketSendV(&sUartCfg, aSegments, 2U) == XST_FAILURE);
+
+	testGetStats(&Stats);
+	TEST_ASSERT(Stats.u4TxFrameCount == 2U);
+}
+
+/*
+ * encode : UartPacketSend into an empty TX ring, the commit starting the TX fifo through the register model
+ * included. decode : UartPacketReceive of a frame already in the RX ring. more frames than the wire record of
+ * the model holds, the receiver is fed from the reference encoder.
+ */
+static void TestCodecThroughput(void)
+{
+	RUINT8 *pu1Frame;
+	RUINT32 u4Size;
+	RUINT32 u4Frame;
+	RUINT32 u4Received = 0U;
+	RUINT32 u4Encoded;
+	uint64_t u8Start;
+	uint64_t u8EncodeNs = 0U;
+	uint64_t u8DecodeNs = 0U;
+
+	testSetUp();
+	testFillPayload(sau1Payload, TEST_BENCH_PAYLOAD, 64U);
+	u4Encoded = testEncode(sau1Payload, TEST_BENCH_PAYLOAD, sau1Expected);
+
+	for(u4Frame = 0U; u4Frame < TEST_BENCH_FRAMES; u4Frame++)
+	{
+		u8Start = testNow();
+		TEST_ASSERT(UartPacketSend(&sUartCfg, sau1Payload, TEST_BENCH_PAYLOAD) == XST_SUCCESS);
+		u8EncodeNs += testNow() - u8Start;
+		testDrainTx();
+
+		testReceive(sau1Expected, u4Encoded);
+
+		u8Start = testNow();
+		if(UartPacketReceive(&sUartCfg, &pu1Frame, &u4Size) == XST_SUCCESS)
+		{
+			u8DecodeNs += testNow() - u8Start;
+			u4Received += (u4Size == TEST_BENCH_PAYLOAD) ? 1U : 0U;
+		}
+	}
+
+	TEST_ASSERT(u4Received == TEST_BENCH_FRAMES);
+	TEST_ASSERT(memcmp(pu1Frame, sau1Payload, TEST_BENCH_PAYLOAD) == 0);
+	testPrintRate("  encode, host clock", (uint64_t)TEST_BENCH_FRAMES * TEST_BENCH_PAYLOAD, u8EncodeNs);
+	testPrintRate("  decode, host clock", (uint64_t)TEST_BENCH_FRAMES * TEST_BENCH_PAYLOAD, u8DecodeNs);
+}
+
+int main(void)
+{
+	TEST_RUN(TestRoundTrip);
+	TEST_RUN(TestEscaping);
+	TEST_RUN(TestCrcReject);
+	TEST_RUN(TestInPlaceAndWrapped);
+	TEST_RUN(TestOversizedFrame);
+	TEST_RUN(TestSendRefusedOverTxFree);
+	TEST_RUN(TestCodecThroughput);
+	return TEST_RESULT();
+}
@@ -0,0 +1,185 @@
+/*
+ * TestUartStdout.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * built with STDOUT_BUFFERED=1 : the STDOUT uart belongs to buffered stdout of the BSP,
+ * InitializeUart refuses it before touching any register and takes the other uart.
+ * outbyte.c of the BSP is built against the uart model with a 64 byte ring : overflow under
+ * both policies, TX empty drain of the ring by the interrupt handler and flush with IRQs masked.
+ */
+
+/**************Includes******************/
+#include <string.h>
+#include "TestCommon.h"
+#include "HostCpu.h"
+#include "GICHostModel.h"
+#include "UartHostModel.h"
+#include "Uart.h"
+#include "GIC.h"
+#include "xparameters.h"
+#include "xil_exception.h"
+#include "xil_printf.h"
+
+/**************Preprocessor******************/
+#define TEST_STDOUT_DEVICE ((STDOUT_BASEADDRESS == 0xE0001000U) ? UART_INSTANCE_DEVICE_1 : UART_INSTANCE_DEVICE_0)
+#define TEST_OTHER_DEVICE ((STDOUT_BASEADDRESS == 0xE0001000U) ? UART_INSTANCE_DEVICE_0 : UART_INSTANCE_DEVICE_1)
+#define TEST_STDOUT_ID ((STDOUT_BASEADDRESS == 0xE0001000U) ? UART_MODEL_UART1_ID : UART_MODEL_UART0_ID)
+#define TEST_UART_CR_OFFSET 0x00U
+#define TEST_UART_BRGR_OFFSET 0x18U
+#define TEST_UART_BRDR_OFFSET 0x34U
+#define TEST_UART_CR_TX_EN 0x10U
+#define TEST_UART_BRGR 20U // ~113 kbaud from the reset reference clock
+#define TEST_UART_BRDR 6U
+#define TEST_UART_IXR_TXEMPTY 0x08U
+#define TEST_STDOUT_ACCEPTED (1U + UART_MODEL_FIFO_DEPTH + STDOUT_BUFFER_SIZE) // shift register, fifo and ring
+#define TEST_STDOUT_EXTRA 10U
+#define TEST_STDOUT_DRAIN_LIMIT (2U * TEST_STDOUT_ACCEPTED) // characters of time before giving up
+
+/**************Definitions******************/
+static GICInstanceType sGic;
+
+static void testCfg(uartCfgType *pCfg, uartDeviceInstanceType Device)
+{
+	memset(pCfg, 0, sizeof(*pCfg));
+	pCfg->DeviceNum = Device;
+	pCfg->BaudRate = UART_BAUDRATE_115200;
+	pCfg->Parity = UART_PARITY_NONE;
+}
+
+static void TestStdoutUartRefused(void)
+{
+	UartHostModelStatsType Stats;
+	uartCfgType StdoutCfg;
+	uartCfgType OtherCfg;
+	uartCfgType *apCfgs[2] = { &OtherCfg, &StdoutCfg };
+
+	HostCpuReset();
+	GICHostModelReset();
+	UartHostModelReset();
+	testCfg(&StdoutCfg, TEST_STDOUT_DEVICE);
+	testCfg(&OtherCfg, TEST_OTHER_DEVICE);
+
+	TEST_ASSERT(InitializeUart(&StdoutCfg) == XST_FAILURE);
+	TEST_ASSERT(InitializeUartMulti(apCfgs, 2U) == XST_FAILURE);
+	UartHostModelGetStats(TEST_STDOUT_DEVICE, &Stats);
+	TEST_ASSERT(Stats.u4RegisterAccesses == 0U);
+
+	TEST_ASSERT(InitializeUart(&OtherCfg) == XST_SUCCESS);
+}
+
+/*fresh CPU, GIC and uart, the STDOUT uart transmitting and its interrupt routed to the stdout handler*/
+static void stdoutSetup(void)
+{
+	HostCpuReset();
+	GICHostModelReset();
+	UartHostModelReset();
+	TEST_ASSERT(InitializeGIC(&sGic) == GIC_SUCCESS);
+	TEST_ASSERT(GICConnectInterruptHandler(&sGic, TEST_STDOUT_ID, (void *)XStdout_InterruptHandler, NULL) == GIC_SUCCESS);
+	TEST_ASSERT(GICEnableInterruptID(TEST_STDOUT_ID) == GIC_SUCCESS);
+	StartGIC();
+	UartHostModelWrite(STDOUT_BASEADDRESS + TEST_UART_BRGR_OFFSET, TEST_UART_BRGR);
+	UartHostModelWrite(STDOUT_BASEADDRESS + TEST_UART_BRDR_OFFSET, TEST_UART_BRDR);
+	UartHostModelWrite(STDOUT_BASEADDRESS + TEST_UART_CR_OFFSET, TEST_UART_CR_TX_EN);
+}
+
+static uint8_t stdoutPattern(uint32_t u4Index)
+{
+	return (uint8_t)('A' + (u4Index % 26U));
+}
+
+/*u4Count pattern bytes through outbyte, returns the wire size before the first one*/
+static uint32_t stdoutWrite(uint32_t u4Count)
+{
+	const uint8_t *pu1Wire;
+	uint32_t u4WireStart = UartHostModelGetWire(TEST_STDOUT_DEVICE, &pu1Wire);
+	uint32_t u4Index;
+
+	for (u4Index = 0U; u4Index < u4Count; u4Index++) {
+		outbyte((char)stdoutPattern(u4Index));
+	}
+	return u4WireStart;
+}
+
+/*the first u4Count pattern bytes are on the wire after u4WireStart, in order*/
+static void stdoutCheckWire(uint32_t u4WireStart, uint32_t u4Count)
+{
+	const uint8_t *pu1Wire;
+	uint32_t u4WireSize = UartHostModelGetWire(TEST_STDOUT_DEVICE, &pu1Wire);
+	uint32_t u4Index;
+
+	TEST_ASSERT(u4WireSize - u4WireStart == u4Count);
+	for (u4Index = 0U; (u4Index < u4Count) && ((u4WireStart + u4Index) < u4WireSize); u4Index++) {
+		TEST_ASSERT(pu1Wire[u4WireStart + u4Index] == stdoutPattern(u4Index));
+	}
+}
+
+/*
+ * DROP : shift register, fifo and ring take TEST_STDOUT_ACCEPTED bytes with IRQs masked, the rest
+ * is counted. once IRQs are back the TX empty interrupt drains the ring to the wire and disables
+ * itself when the ring is empty.
+ */
+static void TestStdoutDropPolicy(void)
+{
+	uint32_t u4DropStart;
+	uint32_t u4WireStart;
+	uint32_t u4Chars;
+
+	stdoutSetup();
+	XStdout_SetPolicy(XSTDOUT_POLICY_DROP);
+	u4DropStart = XStdout_GetDropCount();
+
+	Xil_ExceptionDisable();
+	u4WireStart = stdoutWrite(TEST_STDOUT_ACCEPTED + TEST_STDOUT_EXTRA);
+	TEST_ASSERT(XStdout_GetDropCount() - u4DropStart == TEST_STDOUT_EXTRA);
+	TEST_ASSERT((UartHostModelGetImr(TEST_STDOUT_DEVICE) & TEST_UART_IXR_TXEMPTY) != 0U);
+	Xil_ExceptionEnable();
+
+	for (u4Chars = 0U; (UartHostModelTxBusy(TEST_STDOUT_DEVICE) != 0U) && (u4Chars < TEST_STDOUT_DRAIN_LIMIT); u4Chars++) {
+		UartHostModelAdvance(UartHostModelCharCycles(TEST_STDOUT_DEVICE));
+	}
+	TEST_ASSERT(UartHostModelTxBusy(TEST_STDOUT_DEVICE) == 0U);
+	stdoutCheckWire(u4WireStart, TEST_STDOUT_ACCEPTED);
+	TEST_ASSERT((UartHostModelGetImr(TEST_STDOUT_DEVICE) & TEST_UART_IXR_TXEMPTY) == 0U);
+	TEST_ASSERT(XStdout_GetDropCount() - u4DropStart == TEST_STDOUT_EXTRA);
+	TEST_ASSERT(HostCpuGetExceptionDepth() == 0U);
+}
+
+/*
+ * BLOCK : nothing is lost with IRQs masked, outbyte polls room free in the fifo. the flush sends
+ * the rest without the interrupt and returns only once the last character left the shift register.
+ */
+static void TestStdoutBlockPolicyFlush(void)
+{
+	uint32_t u4DropStart;
+	uint32_t u4WireStart;
+	uint32_t u4IrqStart;
+
+	stdoutSetup();
+	XStdout_SetPolicy(XSTDOUT_POLICY_BLOCK);
+	u4DropStart = XStdout_GetDropCount();
+	u4IrqStart = HostCpuGetIrqCount();
+
+	Xil_ExceptionDisable();
+	u4WireStart = stdoutWrite(TEST_STDOUT_ACCEPTED + TEST_STDOUT_EXTRA);
+	TEST_ASSERT(XStdout_GetDropCount() == u4DropStart);
+	XStdout_Flush();
+	TEST_ASSERT(UartHostModelTxBusy(TEST_STDOUT_DEVICE) == 0U);
+	stdoutCheckWire(u4WireStart, TEST_STDOUT_ACCEPTED + TEST_STDOUT_EXTRA);
+	TEST_ASSERT((UartHostModelGetImr(TEST_STDOUT_DEVICE) & TEST_UART_IXR_TXEMPTY) == 0U);
+	TEST_ASSERT(HostCpuGetIrqCount() == u4IrqStart);
+	Xil_ExceptionEnable();
+
+	XStdout_SetPolicy(XSTDOUT_POLICY_DROP);
+}
+
+int main(void)
+{
+	TEST_RUN(TestStdoutUartRefused);
+	TEST_RUN(TestStdoutDropPolicy);
+	TEST_RUN(TestStdoutBlockPolicyFlush);
+	return TEST_RESULT();
+}
@@ -0,0 +1,354 @@
+/*
+ * TestXScuGic.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * scugic driver of the BSP against the distributor / CPU interface model : XScuGic_InterruptHandlerChained
+ * servicing everything pending in one entry, called directly and as the IRQ exception handler, and
+ * XScuGic_SetPriorityTriggerTypeMask leaving the registers as a loop of XScuGic_SetPriorityTriggerType does.
+ */
+
+/**************Includes******************/
+#include <string.h>
+#include "TestCommon.h"
+#include "HostCpu.h"
+#include "GICHostModel.h"
+#include "xscugic.h"
+#include "xil_exception.h"
+
+/**************Preprocessor******************/
+#define TEST_LOG_SIZE 32U
+#define TEST_SGI_ID 0U
+#define TEST_ID_LOW 40U
+#define TEST_ID_HIGH 41U
+#define TEST_ID_LOWEST 42U
+#define TEST_ID_CHAINED 43U
+#define TEST_CPU0_TARGET 0x01U
+#define TEST_EDGE_TRIGGER 0x03U
+#define TEST_IDLE_PRIORITY 0x100U
+#define TEST_ICDIPR(x) (0x1400U + ((x) * 4U)) // offsets from the SCU base like the model takes them
+#define TEST_ICDICFR(x) (0x1C00U + ((x) * 4U))
+#define TEST_ICDIPR_WORDS ((XSCUGIC_MAX_NUM_INTR_INPUTS + 3U) / 4U)
+#define TEST_ICDICFR_WORDS ((XSCUGIC_MAX_NUM_INTR_INPUTS + 15U) / 16U)
+#define TEST_MASK_CASES 3U
+
+/**************Definitions******************/
+typedef struct {
+	u32 au4Entries[TEST_LOG_SIZE];
+	u32 u4Count;
+} TestLogType;
+
+typedef struct {
+	u32 au4Priority[TEST_ICDIPR_WORDS];
+	u32 au4Config[TEST_ICDICFR_WORDS];
+	u32 u4Writes; // register writes of the call under test
+} TestRegistersType;
+
+typedef struct {
+	u32 au4Mask[XSCUGIC_INTR_MASK_WORDS];
+	u8 u1Priority;
+	u8 u1Trigger;
+} TestMaskCaseType;
+
+/*
+ * 33, 34 and 37 share priority words with unselected IDs, 46 - 49 cross the ICDICFR boundary at 48,
+ * 63 / 64 the mask word boundary. SGI 3 and PPI 29 take the priority only, their configuration is read only.
+ * the low priority bits are not implemented and must be dropped the same way by both.
+ */
+static const TestMaskCaseType saMaskCases[TEST_MASK_CASES] = {
+	{ { (1U << 3U) | (1U << 29U), (1U << 1U) | (1U << 2U) | (1U << 5U) | (0xFU << 8U) | (0xFU << 14U) | (1U << 31U),
+			(1U << 0U) | (1U << 30U) }, 0x4CU, 0x03U },
+	{ { 0U, 0xFFFFFFFFU, 0x7FFFFFFFU }, 0xF8U, 0x01U },
+	{ { 0U, (1U << 15U) | (1U << 16U), 0U }, 0x08U, 0x02U },
+};
+
+static XScuGic sGic;
+static XScuGic_Config sGicConfig;
+static TestLogType sLog;
+
+static void testLog(u32 u4Value)
+{
+	if(sLog.u4Count < TEST_LOG_SIZE)
+	{
+		sLog.au4Entries[sLog.u4Count++] = u4Value;
+	}
+}
+
+static void testSetUp(void)
+{
+	HostCpuReset();
+	GICHostModelReset();
+	memset(&sLog, 0, sizeof(sLog));
+	memset(&sGic, 0, sizeof(sGic));
+	memset(&sGicConfig, 0, sizeof(sGicConfig));
+	sGicConfig.DeviceId = XPAR_PS7_SCUGIC_0_DEVICE_ID;
+	sGicConfig.CpuBaseAddress = XPAR_PS7_SCUGIC_0_BASEADDR;
+	sGicConfig.DistBaseAddress = XPAR_PS7_SCUGIC_0_DIST_BASEADDR;
+	TEST_ASSERT(XScuGic_CfgInitialize(&sGic, &sGicConfig, sGicConfig.CpuBaseAddress) == XST_SUCCESS);
+}
+
+/*callback reference is the ID*/
+static void testLogHandler(void *pArgument)
+{
+	testLog((u32)(UINTPTR)pArgument);
+}
+
+/*pends a lower priority ID while it runs, the chained handler picks it up after the EOI*/
+static void testChainingHandler(void *pArgument)
+{
+	testLog((u32)(UINTPTR)pArgument);
+	GICHostModelPulse(TEST_ID_CHAINED);
+}
+
+static void testConnect(u32 u4ID, Xil_InterruptHandler Handler, u8 u1Priority)
+{
+	TEST_ASSERT(XScuGic_Connect(&sGic, u4ID, Handler, (void *)(UINTPTR)u4ID) == XST_SUCCESS);
+	XScuGic_SetPriorityTriggerType(&sGic, u4ID, u1Priority, TEST_EDGE_TRIGGER);
+	XScuGic_Enable(&sGic, u4ID);
+}
+
+static void testCheckIdle(void)
+{
+	TEST_ASSERT(GICHostModelRunningPriority() == TEST_IDLE_PRIORITY);
+	TEST_ASSERT(GICHostModelIsActive(TEST_ID_LOW) == 0U);
+	TEST_ASSERT(GICHostModelIsPending(TEST_ID_LOW) == 0U);
+	TEST_ASSERT(GICHostModelIsActive(TEST_SGI_ID) == 0U);
+	TEST_ASSERT(GICHostModelIsPending(TEST_SGI_ID) == 0U);
+	TEST_ASSERT(GICHostModelIrqLine() == 0U);
+}
+
+/*SGI and SPIs pending at entry are all handled in one call, highest priority first, each ended*/
+static void TestChainedDispatch(void)
+{
+	GICHostModelStatsType Stats;
+
+	testSetUp();
+	testConnect(TEST_SGI_ID, testLogHandler, 0x10U);
+	testConnect(TEST_ID_LOW, testLogHandler, 0x40U);
+	testConnect(TEST_ID_HIGH, testLogHandler, 0x20U);
+	testConnect(TEST_ID_LOWEST, testLogHandler, 0x60U);
+
+	GICHostModelPulse(TEST_ID_LOWEST);
+	GICHostModelPulse(TEST_ID_LOW);
+	GICHostModelPulse(TEST_ID_HIGH);
+	TEST_ASSERT(XScuGic_SoftwareIntr(&sGic, TEST_SGI_ID, TEST_CPU0_TARGET) == XST_SUCCESS);
+	TEST_ASSERT(GICHostModelIrqLine() == 1U);
+
+	XScuGic_InterruptHandlerChained(&sGic);
+
+	TEST_ASSERT(sLog.u4Count == 4U);
+	TEST_ASSERT(sLog.au4Entries[0] == TEST_SGI_ID);
+	TEST_ASSERT(sLog.au4Entries[1] == TEST_ID_HIGH);
+	TEST_ASSERT(sLog.au4Entries[2] == TEST_ID_LOW);
+	TEST_ASSERT(sLog.au4Entries[3] == TEST_ID_LOWEST);
+	TEST_ASSERT(XScuGic_GetDispatchCount(&sGic, TEST_SGI_ID) == 1U);
+	TEST_ASSERT(XScuGic_GetDispatchCount(&sGic, TEST_ID_HIGH) == 1U);
+	TEST_ASSERT(XScuGic_GetDispatchCount(&sGic, TEST_ID_LOW) == 1U);
+	TEST_ASSERT(XScuGic_GetDispatchCount(&sGic, TEST_ID_LOWEST) == 1U);
+	TEST_ASSERT(sGic.SpuriousInterrupts == 0U);
+
+	// one acknowledge and EOI per source, the loop ends on the single read that returns 1023
+	GICHostModelGetStats(&Stats);
+	TEST_ASSERT(Stats.u4SgiCount == 1U);
+	TEST_ASSERT(Stats.u4AckCount == 4U);
+	TEST_ASSERT(Stats.u4EoiCount == 4U);
+	TEST_ASSERT(Stats.u4EoiErrorCount == 0U);
+	TEST_ASSERT(Stats.u4SpuriousCount == 1U);
+	testCheckIdle();
+}
+
+/*an ID pended by a handler is taken by the same call once the running one is ended*/
+static void TestChainedTailChain(void)
+{
+	GICHostModelStatsType Stats;
+
+	testSetUp();
+	testConnect(TEST_ID_LOW, testChainingHandler, 0x40U);
+	testConnect(TEST_ID_CHAINED, testLogHandler, 0x80U);
+
+	GICHostModelPulse(TEST_ID_LOW);
+	XScuGic_InterruptHandlerChained(&sGic);
+
+	TEST_ASSERT(sLog.u4Count == 2U);
+	TEST_ASSERT(sLog.au4Entries[0] == TEST_ID_LOW);
+	TEST_ASSERT(sLog.au4Entries[1] == TEST_ID_CHAINED);
+	TEST_ASSERT(XScuGic_GetDispatchCount(&sGic, TEST_ID_CHAINED) == 1U);
+	GICHostModelGetStats(&Stats);
+	TEST_ASSERT(Stats.u4EoiCount == 2U);
+	TEST_ASSERT(Stats.u4SpuriousCount == 1U);
+	TEST_ASSERT(GICHostModelIsPending(TEST_ID_CHAINED) == 0U);
+	testCheckIdle();
+}
+
+/*entry with nothing pending is counted, ClearDispatchCounts resets both counters*/
+static void TestChainedSpurious(void)
+{
+	GICHostModelStatsType Stats;
+
+	testSetUp();
+	testConnect(TEST_ID_LOW, testLogHandler, 0x40U);
+
+	XScuGic_InterruptHandlerChained(&sGic);
+	TEST_ASSERT(sLog.u4Count == 0U);
+	TEST_ASSERT(sGic.SpuriousInterrupts == 1U);
+	GICHostModelGetStats(&Stats);
+	TEST_ASSERT(Stats.u4AckCount == 0U);
+	TEST_ASSERT(Stats.u4EoiCount == 0U);
+
+	GICHostModelPulse(TEST_ID_LOW);
+	XScuGic_InterruptHandlerChained(&sGic);
+	TEST_ASSERT(XScuGic_GetDispatchCount(&sGic, TEST_ID_LOW) == 1U);
+	TEST_ASSERT(sGic.SpuriousInterrupts == 1U);
+
+	XScuGic_ClearDispatchCounts(&sGic);
+	TEST_ASSERT(XScuGic_GetDispatchCount(&sGic, TEST_ID_LOW) == 0U);
+	TEST_ASSERT(sGic.SpuriousInterrupts == 0U);
+}
+
+/*as the IRQ exception handler : sources pended while IRQ is masked cost one exception*/
+static void TestChainedException(void)
+{
+	testSetUp();
+	testConnect(TEST_ID_LOW, testLogHandler, 0x40U);
+	testConnect(TEST_ID_HIGH, testLogHandler, 0x20U);
+	testConnect(TEST_ID_LOWEST, testLogHandler, 0x60U);
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_IRQ_INT,
+			(Xil_ExceptionHandler)XScuGic_InterruptHandlerChained, &sGic);
+
+	GICHostModelPulse(TEST_ID_LOWEST);
+	GICHostModelPulse(TEST_ID_LOW);
+	GICHostModelPulse(TEST_ID_HIGH);
+	TEST_ASSERT(HostCpuGetIrqCount() == 0U);
+
+	Xil_ExceptionEnable();
+	TEST_ASSERT(HostCpuGetIrqCount() == 1U);
+	TEST_ASSERT(sLog.u4Count == 3U);
+	TEST_ASSERT(sLog.au4Entries[0] == TEST_ID_HIGH);
+	TEST_ASSERT(sLog.au4Entries[2] == TEST_ID_LOWEST);
+	TEST_ASSERT(HostCpuGetExceptionDepth() == 0U);
+
+	// one more source later is one more exception
+	GICHostModelPulse(TEST_ID_LOW);
+	TEST_ASSERT(HostCpuGetIrqCount() == 2U);
+	TEST_ASSERT(XScuGic_GetDispatchCount(&sGic, TEST_ID_LOW) == 2U);
+	Xil_ExceptionDisable();
+	testCheckIdle();
+}
+
+/*same distinct priority and trigger in every ID so a field written to the wrong place shows*/
+static void testSetBackground(void)
+{
+	u32 u4ID;
+
+	for(u4ID = 0U; u4ID < XSCUGIC_MAX_NUM_INTR_INPUTS; u4ID++)
+	{
+		XScuGic_SetPriorityTriggerType(&sGic, u4ID, (u8)((u4ID * 8U) & 0xF8U), (u8)((u4ID & 1U) != 0U ? 0x03U : 0x01U));
+	}
+}
+
+static void testReadRegisters(TestRegistersType *pRegisters)
+{
+	u32 u4Index;
+
+	for(u4Index = 0U; u4Index < TEST_ICDIPR_WORDS; u4Index++)
+	{
+		pRegisters->au4Priority[u4Index] = GICHostModelRead(TEST_ICDIPR(u4Index));
+	}
+	for(u4Index = 0U; u4Index < TEST_ICDICFR_WORDS; u4Index++)
+	{
+		pRegisters->au4Config[u4Index] = GICHostModelRead(TEST_ICDICFR(u4Index));
+	}
+}
+
+static u32 testWriteCount(void)
+{
+	GICHostModelStatsType Stats;
+
+	GICHostModelGetStats(&Stats);
+	return Stats.u4WriteCount;
+}
+
+static void testApplyLoop(const TestMaskCaseType *pCase, TestRegistersType *pRegisters)
+{
+	u32 u4ID;
+	u32 u4Writes;
+
+	testSetUp();
+	testSetBackground();
+	u4Writes = testWriteCount();
+	for(u4ID = 0U; u4ID < XSCUGIC_MAX_NUM_INTR_INPUTS; u4ID++)
+	{
+		if((pCase->au4Mask[u4ID / 32U] & (1U << (u4ID % 32U))) != 0U)
+		{
+			XScuGic_SetPriorityTriggerType(&sGic, u4ID, pCase->u1Priority, pCase->u1Trigger);
+		}
+	}
+	pRegisters->u4Writes = testWriteCount() - u4Writes;
+	testReadRegisters(pRegisters);
+}
+
+static void testApplyMask(const TestMaskCaseType *pCase, TestRegistersType *pRegisters)
+{
+	u32 u4Writes;
+
+	testSetUp();
+	testSetBackground();
+	u4Writes = testWriteCount();
+	XScuGic_SetPriorityTriggerTypeMask(&sGic, pCase->au4Mask, pCase->u1Priority, pCase->u1Trigger);
+	pRegisters->u4Writes = testWriteCount() - u4Writes;
+	testReadRegisters(pRegisters);
+}
+
+/*mask call leaves every ICDIPR / ICDICFR word as the per ID loop does, with at most as many writes*/
+static void TestSetPriorityTriggerTypeMask(void)
+{
+	TestRegistersType Loop;
+	TestRegistersType Mask;
+	TestRegistersType Background;
+	u32 u4Case;
+	u32 u4Index;
+
+	testSetUp();
+	testSetBackground();
+	testReadRegisters(&Background);
+
+	for(u4Case = 0U; u4Case < TEST_MASK_CASES; u4Case++)
+	{
+		testApplyLoop(&saMaskCases[u4Case], &Loop);
+		testApplyMask(&saMaskCases[u4Case], &Mask);
+
+		for(u4Index = 0U; u4Index < TEST_ICDIPR_WORDS; u4Index++)
+		{
+			TEST_ASSERT(Mask.au4Priority[u4Index] == Loop.au4Priority[u4Index]);
+		}
+		for(u4Index = 0U; u4Index < TEST_ICDICFR_WORDS; u4Index++)
+		{
+			TEST_ASSERT(Mask.au4Config[u4Index] == Loop.au4Config[u4Index]);
+		}
+		TEST_ASSERT(memcmp(&Mask, &Background, sizeof(Mask.au4Priority) + sizeof(Mask.au4Config)) != 0);
+		TEST_ASSERT(Mask.u4Writes <= Loop.u4Writes);
+	}
+
+	// first case by hand : 33 and 34 set, 32 and 35 kept, 47 and 48 on both sides of the ICDICFR boundary
+	testApplyMask(&saMaskCases[0], &Mask);
+	TEST_ASSERT(Mask.au4Priority[8] == ((Background.au4Priority[8] & 0xFF0000FFU) | 0x00484800U));
+	TEST_ASSERT((Mask.au4Priority[0] & 0xFF000000U) == 0x48000000U); // SGI 3
+	TEST_ASSERT(((Mask.au4Config[2] >> 30U) & 0x3U) == 0x3U); // 47
+	TEST_ASSERT((Mask.au4Config[3] & 0x3U) == 0x3U); // 48
+	TEST_ASSERT(Mask.au4Config[0] == Background.au4Config[0]);
+	TEST_ASSERT(Mask.au4Config[1] == Background.au4Config[1]);
+}
+
+int main(void)
+{
+	TEST_RUN(TestChainedDispatch);
+	TEST_RUN(TestChainedTailChain);
+	TEST_RUN(TestChainedSpurious);
+	TEST_RUN(TestChainedException);
+	TEST_RUN(TestSetPriorityTriggerTypeMask);
+
+	return TEST_RESULT();
+}
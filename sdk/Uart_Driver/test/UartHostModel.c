@@ -0,0 +1,645 @@
+/*
+ * UartHostModel.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+/*
+ * Host model of the Zynq PS uart controllers, see UartHostModel.h for what is covered.
+ * Uart.c built with UART_HOST_MODEL=1 sends every register access here, SLCR included.
+ * Model state is brought up to the current CPU model time lazily, on every access and on
+ * UartHostModelAdvance. Interrupt line changes go to the GIC model, which can take the IRQ
+ * right away - every access finishes its state update before the line is driven.
+ */
+
+/**************Includes******************/
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "UartHostModel.h"
+#include "GICHostModel.h"
+#include "HostCpu.h"
+#include "xparameters.h"
+
+/**************Preprocessor******************/
+#define UART_MODEL_BASE 0xE0000000U
+#define UART_MODEL_DEVICE_STRIDE 0x1000U
+#define SLCR_MODEL_BASE 0xF8000000U
+#define SLCR_MODEL_SIZE 0x1000U
+#define SLCR_LOCK_STATUS 0x00CU
+#define SLCR_UNLOCK 0x008U
+#define SLCR_UNLOCK_KEY 0xDF0DU
+#define SLCR_IO_PLL_CTRL 0x108U
+#define SLCR_UART_CLK_CTRL 0x154U
+#define SLCR_UART_RST_CTRL 0x228U
+#define SLCR_PS_CLK_HZ 33333333U
+
+#define CR_OFFSET 0x00U
+#define MR_OFFSET 0x04U
+#define IER_OFFSET 0x08U
+#define IDR_OFFSET 0x0CU
+#define IMR_OFFSET 0x10U
+#define ISR_OFFSET 0x14U
+#define BRGR_OFFSET 0x18U
+#define RXTOUT_OFFSET 0x1CU
+#define RXWM_OFFSET 0x20U
+#define MODEMCR_OFFSET 0x24U
+#define SR_OFFSET 0x2CU
+#define FIFO_OFFSET 0x30U
+#define BRDR_OFFSET 0x34U
+#define FLOWDEL_OFFSET 0x38U
+#define TXWM_OFFSET 0x44U
+
+#define CR_RXRST 0x001U
+#define CR_TXRST 0x002U
+#define CR_RX_EN 0x004U
+#define CR_RX_DIS 0x008U
+#define CR_TX_EN 0x010U
+#define CR_TX_DIS 0x020U
+#define CR_TORST 0x040U
+#define CR_SELF_CLEARING (CR_RXRST | CR_TXRST | CR_TORST)
+#define MR_CLKSEL 0x001U
+#define MR_PARITY_SHIFT 3U
+#define MR_PARITY_MASK 0x07U
+#define MR_STOP_SHIFT 6U
+#define MODEMCR_FCM 0x20U
+
+#define IXR_RXOVR 0x001U // RX fifo reached trigger level
+#define IXR_RXEMPTY 0x002U
+#define IXR_RXFULL 0x004U
+#define IXR_TXEMPTY 0x008U
+#define IXR_TXFULL 0x010U
+#define IXR_OVER 0x020U
+#define IXR_FRAMING 0x040U
+#define IXR_PARITY 0x080U
+#define IXR_TOUT 0x100U
+#define IXR_TOVR 0x1000U
+#define IXR_ALL 0x1FFFU
+
+#define SR_RXOVR 0x0001U
+#define SR_RXEMPTY 0x0002U
+#define SR_RXFULL 0x0004U
+#define SR_TXEMPTY 0x0008U
+#define SR_TXFULL 0x0010U
+#define SR_RACTIVE 0x0400U
+#define SR_TACTIVE 0x0800U
+#define SR_FLOWDEL 0x1000U
+#define SR_TNFUL 0x4000U
+
+/**************Definitions******************/
+typedef struct {
+	uint8_t au1Data[UART_MODEL_FIFO_DEPTH];
+	uint32_t u4Head;
+	uint32_t u4Count;
+} UartModelFifoType;
+
+typedef struct {
+	uint32_t u4Cr;
+	uint32_t u4Mr;
+	uint32_t u4Imr;
+	uint32_t u4Isr;
+	uint32_t u4Brgr;
+	uint32_t u4Brdr;
+	uint32_t u4RxTimeout;
+	uint32_t u4RxTrigger;
+	uint32_t u4ModemCr;
+	uint32_t u4FlowDelay;
+	uint32_t u4TxTrigger;
+	UartModelFifoType TxFifo;
+	UartModelFifoType RxFifo;
+	uint32_t u4Shifting; // a character is in the TX shift register
+	uint8_t u1ShiftByte;
+	uint64_t u8ShiftEnd; // time the character in the shift register is on the wire
+	uint64_t u8NextStart; // earliest time the next character can start
+	uint64_t u8LastRx; // time of the last received character, receiver timeout counts from here
+	uint32_t u4TimeoutArmed;
+	uint32_t u4Line; // interrupt output level last driven to the GIC model
+	uint8_t au1Wire[UART_MODEL_WIRE_SIZE];
+	uint32_t u4WireCount;
+	UartHostModelStatsType Stats;
+} UartModelDeviceType;
+
+static UartModelDeviceType sDevices[UART_MODEL_NUMBER_OF_DEVICES];
+static uint32_t sau4Slcr[SLCR_MODEL_SIZE / 4U];
+static uint32_t su4SlcrLocked;
+static const uint32_t sau4InterruptId[UART_MODEL_NUMBER_OF_DEVICES] = { UART_MODEL_UART0_ID, UART_MODEL_UART1_ID };
+
+static void fifoPush(UartModelFifoType *pFifo, uint8_t u1Byte)
+{
+	pFifo->au1Data[(pFifo->u4Head + pFifo->u4Count) % UART_MODEL_FIFO_DEPTH] = u1Byte;
+	pFifo->u4Count++;
+}
+
+static uint8_t fifoPop(UartModelFifoType *pFifo)
+{
+	uint8_t u1Byte = pFifo->au1Data[pFifo->u4Head];
+
+	pFifo->u4Head = (pFifo->u4Head + 1U) % UART_MODEL_FIFO_DEPTH;
+	pFifo->u4Count--;
+	return u1Byte;
+}
+
+static void deviceReset(UartModelDeviceType *pDevice)
+{
+	uint32_t u4Line = pDevice->u4Line;
+
+	memset(pDevice, 0, offsetof(UartModelDeviceType, au1Wire));
+	pDevice->u4Line = u4Line;
+	pDevice->u4Cr = 0x128U; // TX and RX disabled, stop break
+	pDevice->u4Brgr = 0x28BU;
+	pDevice->u4Brdr = 0x0FU;
+	pDevice->u4RxTrigger = 0x20U;
+	pDevice->u4FlowDelay = 0U;
+	pDevice->u4TxTrigger = 0x20U;
+	pDevice->u8NextStart = HostCpuGetCycles();
+}
+
+void UartHostModelReset(void)
+{
+	uint32_t u4Index;
+
+	memset(sDevices, 0, sizeof(sDevices));
+	for(u4Index = 0U; u4Index < UART_MODEL_NUMBER_OF_DEVICES; u4Index++)
+	{
+		deviceReset(&sDevices[u4Index]);
+	}
+	memset(sau4Slcr, 0, sizeof(sau4Slcr));
+	sau4Slcr[SLCR_IO_PLL_CTRL / 4U] = 30U << 12; // 1 GHz from 33.3 MHz PS_CLK
+	sau4Slcr[SLCR_UART_CLK_CTRL / 4U] = 0x00003F03U;
+	su4SlcrLocked = 1U;
+}
+
+/*uart_ref_clk from SLCR, IO PLL source only - what the driver programs*/
+static uint32_t modelRefClockHz(void)
+{
+	uint32_t u4ClkCtrl = sau4Slcr[SLCR_UART_CLK_CTRL / 4U];
+	uint32_t u4Divisor = (u4ClkCtrl >> 8) & 0x3FU;
+	uint32_t u4PllHz = SLCR_PS_CLK_HZ * ((sau4Slcr[SLCR_IO_PLL_CTRL / 4U] >> 12) & 0x7FU);
+
+	return (u4Divisor == 0U) ? 0U : (u4PllHz / u4Divisor);
+}
+
+static uint64_t modelBitCycles(const UartModelDeviceType *pDevice)
+{
+	uint64_t u8Divider = (uint64_t)pDevice->u4Brgr * (pDevice->u4Brdr + 1U);
+	uint32_t u4RefHz = modelRefClockHz();
+
+	if((pDevice->u4Mr & MR_CLKSEL) != 0U)
+	{
+		u8Divider *= 8U;
+	}
+	if((u4RefHz == 0U) || (u8Divider == 0U))
+	{
+		return 1U;
+	}
+	return ((uint64_t)XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ * u8Divider) / u4RefHz;
+}
+
+static uint64_t modelCharCycles(const UartModelDeviceType *pDevice)
+{
+	uint32_t u4Bits = 10U; // start, 8 data, stop
+	uint32_t u4Parity = (pDevice->u4Mr >> MR_PARITY_SHIFT) & MR_PARITY_MASK;
+
+	if((u4Parity & 0x04U) == 0U)
+	{
+		u4Bits++; // parity bit
+	}
+	if(((pDevice->u4Mr >> MR_STOP_SHIFT) & 0x03U) == 0x02U)
+	{
+		u4Bits++; // 2 stop bits
+	}
+	return modelBitCycles(pDevice) * u4Bits;
+}
+
+static uint32_t txEnabled(const UartModelDeviceType *pDevice)
+{
+	return (((pDevice->u4Cr & CR_TX_EN) != 0U) && ((pDevice->u4Cr & CR_TX_DIS) == 0U)) ? 1U : 0U;
+}
+
+/*moves the transmitter and the receiver timeout up to the current time*/
+static void modelUpdate(UartModelDeviceType *pDevice)
+{
+	uint64_t u8Now = HostCpuGetCycles();
+	uint64_t u8Timeout;
+
+	for(;;)
+	{
+		if(pDevice->u4Shifting != 0U)
+		{
+			if(u8Now < pDevice->u8ShiftEnd)
+			{
+				break;
+			}
+			if(pDevice->u4WireCount < UART_MODEL_WIRE_SIZE)
+			{
+				pDevice->au1Wire[pDevice->u4WireCount] = pDevice->u1ShiftByte;
+			}
+			pDevice->u4WireCount++;
+			pDevice->u4Shifting = 0U;
+			pDevice->u8NextStart = pDevice->u8ShiftEnd;
+		}
+		if((pDevice->TxFifo.u4Count == 0U) || (txEnabled(pDevice) == 0U))
+		{
+			if(pDevice->u8NextStart < u8Now)
+			{
+				pDevice->u8NextStart = u8Now;
+			}
+			break;
+		}
+		// next character starts right after the previous one, or when it was written if the line was idle
+		pDevice->u1ShiftByte = fifoPop(&pDevice->TxFifo);
+		pDevice->u4Shifting = 1U;
+		pDevice->u8ShiftEnd = pDevice->u8NextStart + modelCharCycles(pDevice);
+		if(pDevice->TxFifo.u4Count == 0U)
+		{
+			pDevice->u4Isr |= IXR_TXEMPTY;
+		}
+	}
+
+	if((pDevice->u4TimeoutArmed != 0U) && (pDevice->u4RxTimeout != 0U))
+	{
+		u8Timeout = pDevice->u8LastRx + (modelBitCycles(pDevice) * 4U * pDevice->u4RxTimeout);
+		if(u8Now >= u8Timeout)
+		{
+			pDevice->u4Isr |= IXR_TOUT;
+			pDevice->u4TimeoutArmed = 0U;
+		}
+	}
+}
+
+/*level interrupt output of the controller*/
+static void modelDriveLine(uint32_t u4Device)
+{
+	UartModelDeviceType *pDevice = &sDevices[u4Device];
+	uint32_t u4Line = ((pDevice->u4Isr & pDevice->u4Imr) != 0U) ? 1U : 0U;
+
+	if(u4Line != pDevice->u4Line)
+	{
+		pDevice->u4Line = u4Line;
+		GICHostModelSetLine(sau4InterruptId[u4Device], u4Line);
+	}
+}
+
+static uint32_t modelStatus(const UartModelDeviceType *pDevice)
+{
+	uint32_t u4Status = 0U;
+
+	if(pDevice->RxFifo.u4Count >= pDevice->u4RxTrigger)
+	{
+		u4Status |= SR_RXOVR;
+	}
+	if(pDevice->RxFifo.u4Count == 0U)
+	{
+		u4Status |= SR_RXEMPTY;
+	}
+	if(pDevice->RxFifo.u4Count == UART_MODEL_FIFO_DEPTH)
+	{
+		u4Status |= SR_RXFULL;
+	}
+	if(pDevice->TxFifo.u4Count == 0U)
+	{
+		u4Status |= SR_TXEMPTY;
+	}
+	if(pDevice->TxFifo.u4Count == UART_MODEL_FIFO_DEPTH)
+	{
+		u4Status |= SR_TXFULL;
+	}
+	if(pDevice->TxFifo.u4Count >= (UART_MODEL_FIFO_DEPTH - 1U))
+	{
+		u4Status |= SR_TNFUL;
+	}
+	if(pDevice->u4Shifting != 0U)
+	{
+		u4Status |= SR_TACTIVE;
+	}
+	if(((pDevice->u4ModemCr & MODEMCR_FCM) != 0U) && (pDevice->u4FlowDelay >= 4U) &&
+			(pDevice->RxFifo.u4Count >= pDevice->u4FlowDelay))
+	{
+		u4Status |= SR_FLOWDEL;
+	}
+	return u4Status;
+}
+
+static uint32_t deviceRead(uint32_t u4Device, uint32_t u4Offset)
+{
+	UartModelDeviceType *pDevice = &sDevices[u4Device];
+	uint32_t u4Value = 0U;
+
+	switch(u4Offset)
+	{
+	case CR_OFFSET:
+		u4Value = pDevice->u4Cr;
+		break;
+	case MR_OFFSET:
+		u4Value = pDevice->u4Mr;
+		break;
+	case IMR_OFFSET:
+		u4Value = pDevice->u4Imr;
+		break;
+	case ISR_OFFSET:
+		u4Value = pDevice->u4Isr;
+		break;
+	case BRGR_OFFSET:
+		u4Value = pDevice->u4Brgr;
+		break;
+	case RXTOUT_OFFSET:
+		u4Value = pDevice->u4RxTimeout;
+		break;
+	case RXWM_OFFSET:
+		u4Value = pDevice->u4RxTrigger;
+		break;
+	case MODEMCR_OFFSET:
+		u4Value = pDevice->u4ModemCr;
+		break;
+	case SR_OFFSET:
+		u4Value = modelStatus(pDevice);
+		break;
+	case FIFO_OFFSET:
+		if(pDevice->RxFifo.u4Count != 0U)
+		{
+			u4Value = fifoPop(&pDevice->RxFifo);
+			pDevice->Stats.u4RxFifoReads++;
+			if(pDevice->RxFifo.u4Count == 0U)
+			{
+				pDevice->u4Isr |= IXR_RXEMPTY;
+			}
+		}
+		break;
+	case BRDR_OFFSET:
+		u4Value = pDevice->u4Brdr;
+		break;
+	case FLOWDEL_OFFSET:
+		u4Value = pDevice->u4FlowDelay;
+		break;
+	case TXWM_OFFSET:
+		u4Value = pDevice->u4TxTrigger;
+		break;
+	default:
+		break; // IER / IDR are write only
+	}
+	return u4Value;
+}
+
+static void deviceWrite(uint32_t u4Device, uint32_t u4Offset, uint32_t u4Value)
+{
+	UartModelDeviceType *pDevice = &sDevices[u4Device];
+
+	switch(u4Offset)
+	{
+	case CR_OFFSET:
+		if((u4Value & CR_TXRST) != 0U)
+		{
+			memset(&pDevice->TxFifo, 0, sizeof(pDevice->TxFifo));
+		}
+		if((u4Value & CR_RXRST) != 0U)
+		{
+			memset(&pDevice->RxFifo, 0, sizeof(pDevice->RxFifo));
+		}
+		if((u4Value & CR_TORST) != 0U)
+		{
+			pDevice->u8LastRx = HostCpuGetCycles();
+		}
+		pDevice->u4Cr = u4Value & ~CR_SELF_CLEARING;
+		break;
+	case MR_OFFSET:
+		pDevice->u4Mr = u4Value & 0x3FFU;
+		break;
+	case IER_OFFSET:
+		pDevice->u4Imr |= (u4Value & IXR_ALL);
+		break;
+	case IDR_OFFSET:
+		pDevice->u4Imr &= ~(u4Value & IXR_ALL);
+		break;
+	case ISR_OFFSET:
+		pDevice->u4Isr &= ~u4Value;
+		break;
+	case BRGR_OFFSET:
+		pDevice->u4Brgr = u4Value & 0xFFFFU;
+		break;
+	case RXTOUT_OFFSET:
+		pDevice->u4RxTimeout = u4Value & 0xFFU;
+		break;
+	case RXWM_OFFSET:
+		pDevice->u4RxTrigger = u4Value & 0x3FU;
+		break;
+	case MODEMCR_OFFSET:
+		pDevice->u4ModemCr = u4Value & 0x23U;
+		break;
+	case FIFO_OFFSET:
+		pDevice->Stats.u4TxFifoWrites++;
+		if(pDevice->TxFifo.u4Count == UART_MODEL_FIFO_DEPTH)
+		{
+			pDevice->Stats.u4TxOverflowCount++;
+			pDevice->u4Isr |= IXR_TOVR;
+			break;
+		}
+		if((pDevice->TxFifo.u4Count == 0U) && (pDevice->u4Shifting == 0U) && (txEnabled(pDevice) != 0U))
+		{
+			// driver had data but the line was idle since u8NextStart
+			pDevice->Stats.u8TxIdleCycles += HostCpuGetCycles() - pDevice->u8NextStart;
+		}
+		fifoPush(&pDevice->TxFifo, (uint8_t)u4Value);
+		if(pDevice->TxFifo.u4Count == UART_MODEL_FIFO_DEPTH)
+		{
+			pDevice->u4Isr |= IXR_TXFULL;
+		}
+		break;
+	case BRDR_OFFSET:
+		pDevice->u4Brdr = u4Value & 0xFFU;
+		break;
+	case FLOWDEL_OFFSET:
+		pDevice->u4FlowDelay = u4Value & 0x3FU;
+		break;
+	case TXWM_OFFSET:
+		pDevice->u4TxTrigger = u4Value & 0x3FU;
+		break;
+	default:
+		break;
+	}
+}
+
+static uint32_t slcrRead(uint32_t u4Offset)
+{
+	if(u4Offset == SLCR_LOCK_STATUS)
+	{
+		return su4SlcrLocked;
+	}
+	return sau4Slcr[u4Offset / 4U];
+}
+
+static void slcrWrite(uint32_t u4Offset, uint32_t u4Value)
+{
+	uint32_t u4Device;
+
+	if(u4Offset == SLCR_UNLOCK)
+	{
+		if(u4Value == SLCR_UNLOCK_KEY)
+		{
+			su4SlcrLocked = 0U;
+		}
+		return;
+	}
+	if(su4SlcrLocked != 0U)
+	{
+		fprintf(stderr, "UartHostModel : SLCR write 0x%03X while locked\n", (unsigned)u4Offset);
+		abort();
+	}
+	sau4Slcr[u4Offset / 4U] = u4Value;
+	if(u4Offset == SLCR_UART_RST_CTRL)
+	{
+		// UARTn_REF_RST at bit 2 + n holds the controller in reset
+		for(u4Device = 0U; u4Device < UART_MODEL_NUMBER_OF_DEVICES; u4Device++)
+		{
+			if((u4Value & (0x04U << u4Device)) != 0U)
+			{
+				deviceReset(&sDevices[u4Device]);
+			}
+		}
+	}
+}
+
+static uint32_t modelDevice(uint32_t u4Addr)
+{
+	return (u4Addr - UART_MODEL_BASE) / UART_MODEL_DEVICE_STRIDE;
+}
+
+static uint32_t isUartAddress(uint32_t u4Addr)
+{
+	return ((u4Addr >= UART_MODEL_BASE) && (u4Addr < (UART_MODEL_BASE + (UART_MODEL_DEVICE_STRIDE * UART_MODEL_NUMBER_OF_DEVICES)))) ? 1U : 0U;
+}
+
+uint32_t UartHostModelRead(uint32_t u4Addr)
+{
+	uint32_t u4Device;
+	uint32_t u4Value;
+
+	HostCpuAdvanceCycles(UART_MODEL_ACCESS_CYCLES);
+	if((u4Addr >= SLCR_MODEL_BASE) && (u4Addr < (SLCR_MODEL_BASE + SLCR_MODEL_SIZE)))
+	{
+		return slcrRead(u4Addr - SLCR_MODEL_BASE);
+	}
+	if(isUartAddress(u4Addr) == 0U)
+	{
+		fprintf(stderr, "UartHostModel : read of unmodelled address 0x%08X\n", (unsigned)u4Addr);
+		abort();
+	}
+
+	u4Device = modelDevice(u4Addr);
+	sDevices[u4Device].Stats.u4RegisterAccesses++;
+	modelUpdate(&sDevices[u4Device]);
+	u4Value = deviceRead(u4Device, u4Addr % UART_MODEL_DEVICE_STRIDE);
+	modelDriveLine(u4Device);
+	return u4Value;
+}
+
+void UartHostModelWrite(uint32_t u4Addr, uint32_t u4Value)
+{
+	uint32_t u4Device;
+
+	HostCpuAdvanceCycles(UART_MODEL_ACCESS_CYCLES);
+	if((u4Addr >= SLCR_MODEL_BASE) && (u4Addr < (SLCR_MODEL_BASE + SLCR_MODEL_SIZE)))
+	{
+		slcrWrite(u4Addr - SLCR_MODEL_BASE, u4Value);
+		return;
+	}
+	if(isUartAddress(u4Addr) == 0U)
+	{
+		fprintf(stderr, "UartHostModel : write of unmodelled address 0x%08X\n", (unsigned)u4Addr);
+		abort();
+	}
+
+	u4Device = modelDevice(u4Addr);
+	sDevices[u4Device].Stats.u4RegisterAccesses++;
+	modelUpdate(&sDevices[u4Device]);
+	deviceWrite(u4Device, u4Addr % UART_MODEL_DEVICE_STRIDE, u4Value);
+	modelUpdate(&sDevices[u4Device]); // a byte written to an idle transmitter starts at once
+	modelDriveLine(u4Device);
+}
+
+void UartHostModelAdvance(uint32_t u4Cycles)
+{
+	uint32_t u4Device;
+
+	HostCpuAdvanceCycles(u4Cycles);
+	for(u4Device = 0U; u4Device < UART_MODEL_NUMBER_OF_DEVICES; u4Device++)
+	{
+		modelUpdate(&sDevices[u4Device]);
+		modelDriveLine(u4Device);
+	}
+}
+
+void UartHostModelReceive(uint32_t u4Device, const uint8_t *pu1Data, uint32_t u4Size)
+{
+	UartModelDeviceType *pDevice = &sDevices[u4Device];
+	uint32_t u4Index;
+
+	for(u4Index = 0U; u4Index < u4Size; u4Index++)
+	{
+		HostCpuAdvanceCycles((uint32_t)modelCharCycles(pDevice));
+		modelUpdate(pDevice);
+		if(pDevice->RxFifo.u4Count == UART_MODEL_FIFO_DEPTH)
+		{
+			pDevice->Stats.u4RxOverflowCount++;
+			pDevice->u4Isr |= IXR_OVER;
+		}
+		else
+		{
+			fifoPush(&pDevice->RxFifo, pu1Data[u4Index]);
+			if(pDevice->RxFifo.u4Count == pDevice->u4RxTrigger)
+			{
+				pDevice->u4Isr |= IXR_RXOVR;
+			}
+			if(pDevice->RxFifo.u4Count == UART_MODEL_FIFO_DEPTH)
+			{
+				pDevice->u4Isr |= IXR_RXFULL;
+			}
+		}
+		pDevice->u8LastRx = HostCpuGetCycles();
+		pDevice->u4TimeoutArmed = 1U;
+		modelDriveLine(u4Device);
+	}
+}
+
+void UartHostModelRaiseError(uint32_t u4Device, uint32_t u4IsrBits)
+{
+	sDevices[u4Device].u4Isr |= u4IsrBits;
+	modelDriveLine(u4Device);
+}
+
+uint32_t UartHostModelGetWire(uint32_t u4Device, const uint8_t **ppu1Data)
+{
+	UartModelDeviceType *pDevice = &sDevices[u4Device];
+
+	modelUpdate(pDevice);
+	*ppu1Data = pDevice->au1Wire;
+	return (pDevice->u4WireCount < UART_MODEL_WIRE_SIZE) ? pDevice->u4WireCount : UART_MODEL_WIRE_SIZE;
+}
+
+uint32_t UartHostModelTxLevel(uint32_t u4Device)
+{
+	modelUpdate(&sDevices[u4Device]);
+	return sDevices[u4Device].TxFifo.u4Count;
+}
+
+uint32_t UartHostModelTxBusy(uint32_t u4Device)
+{
+	modelUpdate(&sDevices[u4Device]);
+	return ((sDevices[u4Device].TxFifo.u4Count != 0U) || (sDevices[u4Device].u4Shifting != 0U)) ? 1U : 0U;
+}
+
+uint32_t UartHostModelGetImr(uint32_t u4Device)
+{
+	return sDevices[u4Device].u4Imr;
+}
+
+uint32_t UartHostModelCharCycles(uint32_t u4Device)
+{
+	return (uint32_t)modelCharCycles(&sDevices[u4Device]);
+}
+
+void UartHostModelGetStats(uint32_t u4Device, UartHostModelStatsType *pStats)
+{
+	*pStats = sDevices[u4Device].Stats;
+}
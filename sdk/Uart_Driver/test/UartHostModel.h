@@ -0,0 +1,51 @@
+/*
+ * UartHostModel.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef TEST_UARTHOSTMODEL_H_
+#define TEST_UARTHOSTMODEL_H_
+/**************Inclusions******************/
+#include <stdint.h>
+/**************Macros******************/
+#define UART_MODEL_NUMBER_OF_DEVICES 2U
+#define UART_MODEL_FIFO_DEPTH 64U
+#define UART_MODEL_WIRE_SIZE 16384U // bytes kept of what each controller sent on its TX line
+#define UART_MODEL_ACCESS_CYCLES 40U // CPU cycles of one APB register access
+#define UART_MODEL_UART0_ID 59U
+#define UART_MODEL_UART1_ID 82U
+
+/**************Definitions******************/
+typedef struct {
+	uint32_t u4TxOverflowCount; // FIFO writes while TX fifo was full, byte lost
+	uint32_t u4RxOverflowCount; // bytes received while RX fifo was full, byte lost
+	uint32_t u4TxFifoWrites;
+	uint32_t u4RxFifoReads;
+	uint32_t u4RegisterAccesses;
+	uint64_t u8TxIdleCycles; // cycles the transmitter waited for data while the driver had something to send
+} UartHostModelStatsType;
+
+/**************Prototypes******************/
+/*
+ * cycle timed model of the two PS uart controllers and the SLCR registers the driver touches.
+ * TX : 64 byte fifo, one character leaves the shift register every character time derived from
+ * BRGR / BRDR / MR_CLKSEL and the reference clock programmed in SLCR, TX empty event when the fifo
+ * runs empty. RX : 64 byte fifo with trigger level, full, overflow and receiver timeout events.
+ * ISR is sticky / write 1 to clear, IMR follows IER / IDR, the interrupt line (ISR & IMR) drives
+ * GIC ID 59 / 82 of the GIC model. time is the CPU model clock, every register access advances it.
+ */
+void UartHostModelReset(void);
+uint32_t UartHostModelRead(uint32_t u4Addr);
+void UartHostModelWrite(uint32_t u4Addr, uint32_t u4Value);
+void UartHostModelAdvance(uint32_t u4Cycles); // time passes outside of register accesses (e.g. main loop work)
+void UartHostModelReceive(uint32_t u4Device, const uint8_t *pu1Data, uint32_t u4Size); // bytes arrive back to back at line rate
+void UartHostModelRaiseError(uint32_t u4Device, uint32_t u4IsrBits); // framing / parity / overrun event
+uint32_t UartHostModelGetWire(uint32_t u4Device, const uint8_t **ppu1Data); // bytes sent so far
+uint32_t UartHostModelTxLevel(uint32_t u4Device);
+uint32_t UartHostModelTxBusy(uint32_t u4Device); // fifo or shift register holds data
+uint32_t UartHostModelGetImr(uint32_t u4Device);
+uint32_t UartHostModelCharCycles(uint32_t u4Device); // CPU cycles of one character at the programmed rate
+void UartHostModelGetStats(uint32_t u4Device, UartHostModelStatsType *pStats);
+
+#endif /* TEST_UARTHOSTMODEL_H_ */
@@ -0,0 +1,12 @@
+/*
+ * bspconfig.h
+ *
+ * host build stand-in of the generated BSP header
+ */
+
+#ifndef TEST_BSP_BSPCONFIG_H_
+#define TEST_BSP_BSPCONFIG_H_
+
+#define FPU_HARD_FLOAT_ABI_ENABLED 1
+
+#endif /* TEST_BSP_BSPCONFIG_H_ */
@@ -0,0 +1,15 @@
+/*
+ * sleep.h
+ *
+ * host build stand-in, delays advance the modelled time instead of waiting
+ */
+
+#ifndef TEST_BSP_SLEEP_H_
+#define TEST_BSP_SLEEP_H_
+
+#include "xil_types.h"
+
+int usleep(unsigned long useconds);
+unsigned sleep(unsigned int seconds);
+
+#endif /* TEST_BSP_SLEEP_H_ */
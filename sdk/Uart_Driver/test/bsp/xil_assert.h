@@ -0,0 +1,24 @@
+/*
+ * xil_assert.h
+ *
+ * host build stand-in of the standalone BSP header, a failed driver assertion stops the test program
+ */
+
+#ifndef TEST_BSP_XIL_ASSERT_H_
+#define TEST_BSP_XIL_ASSERT_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "xil_types.h"
+
+#define Xil_AssertVoid(Expression) \
+	do { \
+		if(!(Expression)) { \
+			printf("  ASSERT %s:%d : %s\n", __FILE__, __LINE__, #Expression); \
+			abort(); \
+		} \
+	} while(0)
+
+#define Xil_AssertNonvoid(Expression) Xil_AssertVoid(Expression)
+
+#endif /* TEST_BSP_XIL_ASSERT_H_ */
@@ -0,0 +1,37 @@
+/*
+ * xil_exception.h
+ *
+ * host build stand-in of the standalone BSP header. IRQ / FIQ exceptions are taken by the
+ * CPU model in HostCpu.c when the GIC model signals them and CPSR lets them in.
+ */
+
+#ifndef TEST_BSP_XIL_EXCEPTION_H_
+#define TEST_BSP_XIL_EXCEPTION_H_
+
+#include "xil_types.h"
+#include "xpseudo_asm.h"
+#include "HostCpu.h"
+
+#define XIL_EXCEPTION_FIQ	XREG_CPSR_FIQ_ENABLE
+#define XIL_EXCEPTION_IRQ	XREG_CPSR_IRQ_ENABLE
+#define XIL_EXCEPTION_ALL	(XREG_CPSR_FIQ_ENABLE | XREG_CPSR_IRQ_ENABLE)
+
+#define XIL_EXCEPTION_ID_IRQ_INT		5U
+#define XIL_EXCEPTION_ID_FIQ_INT		6U
+#define XIL_EXCEPTION_ID_LAST			6U
+
+typedef void (*Xil_ExceptionHandler)(void *data);
+typedef void (*Xil_InterruptHandler)(void *data);
+
+void Xil_ExceptionRegisterHandler(u32 Exception_id, Xil_ExceptionHandler Handler, void *Data);
+
+#define Xil_ExceptionEnableMask(Mask) mtcpsr(mfcpsr() & ~((Mask) & XIL_EXCEPTION_ALL))
+#define Xil_ExceptionEnable() Xil_ExceptionEnableMask(XIL_EXCEPTION_IRQ)
+#define Xil_ExceptionDisableMask(Mask) mtcpsr(mfcpsr() | ((Mask) & XIL_EXCEPTION_ALL))
+#define Xil_ExceptionDisable() Xil_ExceptionDisableMask(XIL_EXCEPTION_IRQ)
+
+/*same mode switch as the target macros : system mode with IRQ and FIQ enabled, back to the saved state*/
+#define Xil_EnableNestedInterrupts() HostCpuEnableNestedInterrupts()
+#define Xil_DisableNestedInterrupts() HostCpuDisableNestedInterrupts()
+
+#endif /* TEST_BSP_XIL_EXCEPTION_H_ */
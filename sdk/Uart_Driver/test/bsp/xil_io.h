@@ -0,0 +1,27 @@
+/*
+ * xil_io.h
+ *
+ * host build stand-in. accesses of the BSP drivers to the MPCore private registers go to the GIC model
+ * in GICHostModel.c, offsets are taken from the SCU base like GIC.c does.
+ */
+
+#ifndef TEST_BSP_XIL_IO_H_
+#define TEST_BSP_XIL_IO_H_
+
+#include "xil_types.h"
+#include "xil_printf.h"
+#include "GICHostModel.h"
+
+#define XIL_IO_SCU_PERIPH_BASE 0xF8F00000U
+
+static inline u32 Xil_In32(UINTPTR Addr)
+{
+	return GICHostModelRead((u32)(Addr - XIL_IO_SCU_PERIPH_BASE));
+}
+
+static inline void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	GICHostModelWrite(Value, (u32)(Addr - XIL_IO_SCU_PERIPH_BASE));
+}
+
+#endif /* TEST_BSP_XIL_IO_H_ */
@@ -0,0 +1,25 @@
+/*
+ * xil_mmu.h
+ *
+ * host build stand-in of the standalone BSP header, same attribute values. Xil_SetTlbAttributes is
+ * recorded by the CPU model in HostCpu.c, host memory is not remapped.
+ */
+
+#ifndef TEST_BSP_XIL_MMU_H_
+#define TEST_BSP_XIL_MMU_H_
+
+#include "xil_types.h"
+
+#define NORM_NONCACHE 0x11DE2
+#define STRONG_ORDERED 0xC02
+#define DEVICE_MEMORY 0xC06
+#define RESERVED 0x0
+#define NORM_WT_CACHE 0x16DEA
+#define NORM_WB_CACHE 0x15DE6
+#define SHAREABLE (0x1 << 16)
+#define NON_SHAREABLE (~(0x1 << 16))
+#define EXECUTE_NEVER ((0x1 << 4) | (0x1 << 0))
+
+void Xil_SetTlbAttributes(INTPTR Addr, u32 attrib);
+
+#endif /* TEST_BSP_XIL_MMU_H_ */
@@ -0,0 +1,37 @@
+/*
+ * xil_printf.h
+ *
+ * host build stand-in
+ */
+
+#ifndef TEST_BSP_XIL_PRINTF_H_
+#define TEST_BSP_XIL_PRINTF_H_
+
+#include <stdio.h>
+#include "xil_types.h"
+#include "xparameters.h"
+
+#define xil_printf printf
+#define print(s) fputs((s), stdout)
+
+/*buffered stdout of outbyte.c, same switches as the BSP header*/
+#ifndef STDOUT_BUFFERED
+#define STDOUT_BUFFERED 0
+#endif
+
+#ifndef STDOUT_BUFFER_SIZE
+#define STDOUT_BUFFER_SIZE 1024U
+#endif
+
+#define XSTDOUT_POLICY_DROP	0U
+#define XSTDOUT_POLICY_BLOCK	1U
+
+#if STDOUT_BUFFERED
+void outbyte(char c);
+void XStdout_InterruptHandler(void *CallBackRef);
+void XStdout_Flush(void);
+void XStdout_SetPolicy(u32 Policy);
+u32 XStdout_GetDropCount(void);
+#endif
+
+#endif /* TEST_BSP_XIL_PRINTF_H_ */
@@ -0,0 +1,30 @@
+/*
+ * xil_types.h
+ *
+ * host build stand-in of the standalone BSP header, only what the driver sources use
+ */
+
+#ifndef TEST_BSP_XIL_TYPES_H_
+#define TEST_BSP_XIL_TYPES_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int32_t s32;
+typedef intptr_t INTPTR;
+typedef uintptr_t UINTPTR;
+
+#define XIL_COMPONENT_IS_READY 0x11111111U
+
+#ifndef TRUE
+#define TRUE 1U
+#endif
+#ifndef FALSE
+#define FALSE 0U
+#endif
+
+#endif /* TEST_BSP_XIL_TYPES_H_ */
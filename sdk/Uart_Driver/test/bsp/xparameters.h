@@ -0,0 +1,21 @@
+/*
+ * xparameters.h
+ *
+ * host build stand-in, values of the Zybo hardware design the driver is built for
+ */
+
+#ifndef TEST_BSP_XPARAMETERS_H_
+#define TEST_BSP_XPARAMETERS_H_
+
+#define XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ 666666687
+#define XPAR_PS7_UART_1_UART_CLK_FREQ_HZ 50000000
+#define STDOUT_BASEADDRESS 0xE0001000
+#define PLATFORM_ZYNQ
+#define XPAR_CPU_ID 0U
+#define XPAR_PS7_SCUGIC_0_DEVICE_ID 0U
+#define XPAR_PS7_SCUGIC_0_BASEADDR 0xF8F00100U
+#define XPAR_PS7_SCUGIC_0_DIST_BASEADDR 0xF8F01000U
+#define XPAR_SCUGIC_0_DIST_BASEADDR 0xF8F01000U
+#define XPS_EFUSE_BASEADDR 0xF800D000U
+
+#endif /* TEST_BSP_XPARAMETERS_H_ */
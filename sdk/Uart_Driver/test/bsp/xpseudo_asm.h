@@ -0,0 +1,23 @@
+/*
+ * xpseudo_asm.h
+ *
+ * host build stand-in of the standalone BSP header. CPSR and CP15 accesses go to the CPU model
+ * in HostCpu.c, barriers become compiler / host barriers.
+ */
+
+#ifndef TEST_BSP_XPSEUDO_ASM_H_
+#define TEST_BSP_XPSEUDO_ASM_H_
+
+#include "xil_types.h"
+#include "xreg_cortexa9.h"
+#include "HostCpu.h"
+
+#define mfcpsr() HostCpuGetCpsr()
+#define mtcpsr(v) HostCpuSetCpsr((u32)(v))
+#define mfcp(rn) HostCpuReadCp15(rn)
+#define mtcp(rn, v) HostCpuWriteCp15((rn), (u32)(v))
+#define dsb() __sync_synchronize()
+#define dmb() __sync_synchronize()
+#define isb() __sync_synchronize()
+
+#endif /* TEST_BSP_XPSEUDO_ASM_H_ */
@@ -0,0 +1,25 @@
+/*
+ * xreg_cortexa9.h
+ *
+ * host build stand-in of the standalone BSP header. CP15 registers keep the names and encodings
+ * of the target header, HostCpuReadCp15 / HostCpuWriteCp15 tell them apart by that string.
+ */
+
+#ifndef TEST_BSP_XREG_CORTEXA9_H_
+#define TEST_BSP_XREG_CORTEXA9_H_
+
+#define XREG_CPSR_MODE_BITS			0x1F
+#define XREG_CPSR_SYSTEM_MODE			0x1F
+#define XREG_CPSR_SVC_MODE			0x13
+#define XREG_CPSR_IRQ_MODE			0x12
+#define XREG_CPSR_FIQ_MODE			0x11
+#define XREG_CPSR_IRQ_ENABLE			0x80
+#define XREG_CPSR_FIQ_ENABLE			0x40
+
+#define XREG_CP15_MULTI_PROC_AFFINITY		"p15, 0, %0,  c0,  c0, 5"
+#define XREG_CP15_PERF_MONITOR_CTRL		"p15, 0, %0,  c9, c12, 0"
+#define XREG_CP15_COUNT_ENABLE_SET		"p15, 0, %0,  c9, c12, 1"
+#define XREG_CP15_COUNT_ENABLE_CLR		"p15, 0, %0,  c9, c12, 2"
+#define XREG_CP15_PERF_CYCLE_COUNTER		"p15, 0, %0,  c9, c13, 0"
+
+#endif /* TEST_BSP_XREG_CORTEXA9_H_ */
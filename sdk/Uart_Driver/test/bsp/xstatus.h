@@ -0,0 +1,13 @@
+/*
+ * xstatus.h
+ *
+ * host build stand-in of the standalone BSP header, only what the driver sources use
+ */
+
+#ifndef TEST_BSP_XSTATUS_H_
+#define TEST_BSP_XSTATUS_H_
+
+#define XST_SUCCESS 0L
+#define XST_FAILURE 1L
+
+#endif /* TEST_BSP_XSTATUS_H_ */
@@ -0,0 +1,35 @@
+/*
+ * xuartps_hw.h
+ *
+ * host build stand-in of the standalone BSP header, register accesses go to the uart model in
+ * UartHostModel.c. only what outbyte.c uses.
+ */
+
+#ifndef TEST_BSP_XUARTPS_HW_H_
+#define TEST_BSP_XUARTPS_HW_H_
+
+#include "xil_types.h"
+#include "UartHostModel.h"
+
+#define XUARTPS_IER_OFFSET	0x0008U
+#define XUARTPS_IDR_OFFSET	0x000CU
+#define XUARTPS_ISR_OFFSET	0x0014U
+#define XUARTPS_SR_OFFSET	0x002CU
+#define XUARTPS_FIFO_OFFSET	0x0030U
+
+#define XUARTPS_IXR_TXEMPTY	0x00000008U
+
+#define XUARTPS_SR_TACTIVE	0x00000800U
+#define XUARTPS_SR_TXFULL	0x00000010U
+#define XUARTPS_SR_TXEMPTY	0x00000008U
+
+#define XUartPs_ReadReg(BaseAddress, RegOffset) \
+	UartHostModelRead((BaseAddress) + (u32)(RegOffset))
+#define XUartPs_WriteReg(BaseAddress, RegOffset, RegisterValue) \
+	UartHostModelWrite((BaseAddress) + (u32)(RegOffset), (u32)(RegisterValue))
+#define XUartPs_IsTransmitFull(BaseAddress) \
+	((XUartPs_ReadReg((BaseAddress), XUARTPS_SR_OFFSET) & XUARTPS_SR_TXFULL) == XUARTPS_SR_TXFULL)
+
+void XUartPs_SendByte(u32 BaseAddress, u8 Data);
+
+#endif /* TEST_BSP_XUARTPS_HW_H_ */